@@ -0,0 +1,185 @@
+#ifndef FLAT_MAP_H
+#define FLAT_MAP_H
+
+#pragma once
+
+#include <cstddef>
+#include "Type_Traits.h"
+#include "Small_Vector.h"
+
+namespace ACBYTES
+{
+#pragma region Flat_Map
+	/*
+	* Map over sorted arrays. Keys and values live in separate Small_Vectors, so a lookup's binary search only touches keys.
+	* Lookups are O(log n); insertion and erasure shift the following elements, which is cheap for the small maps it is meant for.
+	* Inserting or erasing invalidates pointers to values.
+	* @param K [Key type, ordered with operator <].
+	* @param V [Value type].
+	* @param N [Number of entries stored without a heap allocation].
+	*/
+	template <typename K, typename V, size_t N = 8>
+	class Flat_Map
+	{
+		Small_Vector<K, N> _keys;
+		Small_Vector<V, N> _values;
+
+		bool Matches(size_t Index, const K& Key) const noexcept
+		{
+			return Index < _keys.Size() && !(Key < _keys[Index]);
+		}
+
+		/*
+		* Inserts an entry built beforehand. Both arrays get room first, so unless moving K or V throws, a failure leaves the map unchanged
+		* instead of with a key missing its value. Building first also keeps Key and Value valid if they refer into the map.
+		*/
+		V& Insert(size_t Index, K&& Key, V&& Value)
+		{
+			if (_keys.Size() == _keys.Capacity())
+				_keys.Reserve(_keys.Capacity() * 2);
+			if (_values.Size() == _values.Capacity())
+				_values.Reserve(_values.Capacity() * 2);
+			auto& value = _values.Emplace(Index, Move(Value));
+			_keys.Emplace(Index, Move(Key));
+			return value;
+		}
+
+	public:
+		using keyType = K;
+		using valueType = V;
+
+		[[nodiscard]] Flat_Map() noexcept
+		{
+		}
+
+		void Reserve(size_t Capacity)
+		{
+			_keys.Reserve(Capacity);
+			_values.Reserve(Capacity);
+		}
+
+		/*
+		* Index of the first key not less than Key.
+		*/
+		size_t LowerBound(const K& Key) const noexcept
+		{
+			auto keys = _keys.Data();
+			size_t first = 0;
+			size_t count = _keys.Size();
+			while (count > 0)
+			{
+				auto half = count / 2;
+				if (keys[first + half] < Key)
+				{
+					first += half + 1;
+					count -= half + 1;
+				}
+				else
+					count = half;
+			}
+			return first;
+		}
+
+		/*
+		* Returns nullptr if Key isn't in the map.
+		*/
+		V* Find(const K& Key) noexcept
+		{
+			auto index = LowerBound(Key);
+			return Matches(index, Key) ? &_values[index] : nullptr;
+		}
+
+		const V* Find(const K& Key) const noexcept
+		{
+			auto index = LowerBound(Key);
+			return Matches(index, Key) ? &_values[index] : nullptr;
+		}
+
+		bool Contains(const K& Key) const noexcept
+		{
+			return Matches(LowerBound(Key), Key);
+		}
+
+		/*
+		* Constructs a value from Arguments under Key unless Key is already present. Returns whether it was inserted.
+		*/
+		template <typename K1, typename... ArgT>
+		bool Emplace(K1&& Key, ArgT&&... Arguments)
+		{
+			auto index = LowerBound(Key);
+			if (Matches(index, Key))
+				return false;
+			V value(Forward<ArgT>(Arguments)...);
+			Insert(index, K(Forward<K1>(Key)), Move(value));
+			return true;
+		}
+
+		template <typename K1, typename V1>
+		V& InsertOrAssign(K1&& Key, V1&& Value)
+		{
+			auto index = LowerBound(Key);
+			if (Matches(index, Key))
+				return _values[index] = Forward<V1>(Value);
+			V value(Forward<V1>(Value));
+			return Insert(index, K(Forward<K1>(Key)), Move(value));
+		}
+
+		/*
+		* Value under Key, value-initialized and inserted first if missing.
+		*/
+		V& operator [](const K& Key)
+		{
+			auto index = LowerBound(Key);
+			if (!Matches(index, Key))
+				return Insert(index, K(Key), V());
+			return _values[index];
+		}
+
+		bool Erase(const K& Key) noexcept
+		{
+			auto index = LowerBound(Key);
+			if (!Matches(index, Key))
+				return false;
+			_keys.Erase(index);
+			_values.Erase(index);
+			return true;
+		}
+
+		void Clear() noexcept
+		{
+			_keys.Clear();
+			_values.Clear();
+		}
+
+		size_t Size() const noexcept
+		{
+			return _keys.Size();
+		}
+
+		bool Empty() const noexcept
+		{
+			return _keys.Empty();
+		}
+
+		/*
+		* Entries in key order, by index.
+		*/
+		const K& KeyAt(size_t Index) const noexcept
+		{
+			return _keys[Index];
+		}
+
+		V& ValueAt(size_t Index) noexcept
+		{
+			return _values[Index];
+		}
+
+		const V& ValueAt(size_t Index) const noexcept
+		{
+			return _values[Index];
+		}
+	};
+#pragma endregion Flat_Map
+}
+
+#endif FLAT_MAP_H
\ No newline at end of file
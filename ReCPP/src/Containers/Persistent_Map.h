@@ -0,0 +1,459 @@
+#ifndef PERSISTENT_MAP_H
+#define PERSISTENT_MAP_H
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Persistent_Map
+	/*
+	* Immutable hash map whose versions share structure: a hash array mapped trie (Bagwell) in the CHAMP layout (Steindorfer),
+	* where each node keeps inline entries and child nodes in two arrays indexed by two 32-bit maps of 5-bit hash fragments.
+	* Set and Erase return a new version and copy only the O(log32 n) nodes on one path. Keys whose full hashes collide share a
+	* collision node at the bottom.
+	* Nodes are reference counted with atomics, so versions can be read, copied and dropped from any thread.
+	* A Transient edits nodes no other version uses in place, for batches of updates; it is used by one thread at a time.
+	* @param K [Key type].
+	* @param V [Value type, copied along with keys when a shared node is edited].
+	* @param Hash [Hasher of K].
+	* @param Key_Equal [Equality of K].
+	*/
+	template <typename K, typename V, typename Hash = std::hash<K>, typename Key_Equal = std::equal_to<K>>
+	class Persistent_Map
+	{
+		static constexpr uint32_t bits = 5;
+		static constexpr uint32_t mask = (1u << bits) - 1;
+		static constexpr uint32_t hash_bits = sizeof(size_t) * 8;
+
+		struct Entry
+		{
+			size_t hash;
+			K key;
+			V value;
+		};
+
+		struct Node
+		{
+			std::atomic<uint32_t> references{ 1 };
+			uint32_t dataMap = 0;
+			uint32_t nodeMap = 0;
+			//Collision nodes keep every entry in entries and leave both maps empty.
+			bool collision = false;
+			std::vector<Entry> entries;
+			std::vector<Node*> children;
+
+			~Node()
+			{
+				for (auto child : children)
+					Release(child);
+			}
+		};
+
+		Node* _root = nullptr;
+		size_t _size = 0;
+		NO_UNIQUE_ADDRESS Hash _hash;
+		NO_UNIQUE_ADDRESS Key_Equal _equal;
+
+		static uint32_t PopCount(uint32_t Value) noexcept
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			Value = Value - ((Value >> 1) & 0x55555555u);
+			Value = (Value & 0x33333333u) + ((Value >> 2) & 0x33333333u);
+			return (((Value + (Value >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+#else
+			return static_cast<uint32_t>(__builtin_popcount(Value));
+#endif
+		}
+
+		static uint32_t Fragment(size_t KeyHash, uint32_t Shift) noexcept
+		{
+			return 1u << ((KeyHash >> Shift) & mask);
+		}
+
+		//Position among the set bits of Map below Bit.
+		static size_t IndexOf(uint32_t Map, uint32_t Bit) noexcept
+		{
+			return PopCount(Map & (Bit - 1));
+		}
+
+		static Node* Retain(Node* Target) noexcept
+		{
+			if (Target)
+				Target->references.fetch_add(1, std::memory_order_relaxed);
+			return Target;
+		}
+
+		static void Release(Node* Target) noexcept
+		{
+			if (Target && Target->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				delete Target;
+		}
+
+		/*
+		* Makes the node in Slot safe to edit, creating it when empty: it is only copied when another version or Transient also uses it.
+		*/
+		static Node* Unique(Node*& Slot)
+		{
+			if (!Slot)
+				return Slot = new Node();
+			if (Slot->references.load(std::memory_order_acquire) == 1)
+				return Slot;
+			auto copy = new Node();
+			copy->dataMap = Slot->dataMap;
+			copy->nodeMap = Slot->nodeMap;
+			copy->collision = Slot->collision;
+			copy->entries = Slot->entries;
+			copy->children.reserve(Slot->children.size());
+			for (auto child : Slot->children)
+				copy->children.push_back(Retain(child));
+			Release(Slot);
+			return Slot = copy;
+		}
+
+		/*
+		* Node holding two entries whose hashes agree below Shift.
+		*/
+		static Node* Merge(Entry&& First, Entry&& Second, uint32_t Shift)
+		{
+			auto node = new Node();
+			if (Shift >= hash_bits)
+			{
+				node->collision = true;
+				node->entries.reserve(2);
+				node->entries.push_back(Move(First));
+				node->entries.push_back(Move(Second));
+				return node;
+			}
+			auto first = Fragment(First.hash, Shift);
+			auto second = Fragment(Second.hash, Shift);
+			if (first == second)
+			{
+				node->nodeMap = first;
+				node->children.push_back(Merge(Move(First), Move(Second), Shift + bits));
+				return node;
+			}
+			node->dataMap = first | second;
+			node->entries.reserve(2);
+			if (first < second)
+			{
+				node->entries.push_back(Move(First));
+				node->entries.push_back(Move(Second));
+			}
+			else
+			{
+				node->entries.push_back(Move(Second));
+				node->entries.push_back(Move(First));
+			}
+			return node;
+		}
+
+		/*
+		* Returns whether Value's key was new.
+		*/
+		bool EditSet(Node*& Slot, uint32_t Shift, Entry&& Value)
+		{
+			auto node = Unique(Slot);
+			if (node->collision)
+			{
+				for (auto& entry : node->entries)
+				{
+					if (_equal(entry.key, Value.key))
+					{
+						entry.value = Move(Value.value);
+						return false;
+					}
+				}
+				node->entries.push_back(Move(Value));
+				return true;
+			}
+
+			auto bit = Fragment(Value.hash, Shift);
+			if (node->dataMap & bit)
+			{
+				auto index = IndexOf(node->dataMap, bit);
+				auto& entry = node->entries[index];
+				if (entry.hash == Value.hash && _equal(entry.key, Value.key))
+				{
+					entry.value = Move(Value.value);
+					return false;
+				}
+				auto child = Merge(Move(entry), Move(Value), Shift + bits);
+				node->entries.erase(node->entries.begin() + index);
+				node->dataMap &= ~bit;
+				node->children.insert(node->children.begin() + IndexOf(node->nodeMap, bit), child);
+				node->nodeMap |= bit;
+				return true;
+			}
+			if (node->nodeMap & bit)
+				return EditSet(node->children[IndexOf(node->nodeMap, bit)], Shift + bits, Move(Value));
+
+			node->entries.insert(node->entries.begin() + IndexOf(node->dataMap, bit), Move(Value));
+			node->dataMap |= bit;
+			return true;
+		}
+
+		/*
+		* Removes Key, which must be present. A child left with a single entry and no children is folded into its parent, keeping
+		* the trie canonical.
+		*/
+		void EditErase(Node*& Slot, uint32_t Shift, size_t KeyHash, const K& Key)
+		{
+			auto node = Unique(Slot);
+			if (node->collision)
+			{
+				for (auto i = node->entries.begin(); i != node->entries.end(); i++)
+				{
+					if (_equal(i->key, Key))
+					{
+						node->entries.erase(i);
+						return;
+					}
+				}
+				return;
+			}
+
+			auto bit = Fragment(KeyHash, Shift);
+			if (node->dataMap & bit)
+			{
+				node->entries.erase(node->entries.begin() + IndexOf(node->dataMap, bit));
+				node->dataMap &= ~bit;
+				return;
+			}
+
+			auto childIndex = IndexOf(node->nodeMap, bit);
+			auto& child = node->children[childIndex];
+			EditErase(child, Shift + bits, KeyHash, Key);
+			if (child->children.empty() && child->entries.size() == 1)
+			{
+				auto entry = Move(child->entries.front());
+				Release(child);
+				node->children.erase(node->children.begin() + childIndex);
+				node->nodeMap &= ~bit;
+				node->entries.insert(node->entries.begin() + IndexOf(node->dataMap, bit), Move(entry));
+				node->dataMap |= bit;
+			}
+		}
+
+		template <typename Function>
+		static void ForEach(const Node* Target, Function& Visit)
+		{
+			for (auto& entry : Target->entries)
+				Visit(entry.key, entry.value);
+			for (auto child : Target->children)
+				ForEach(child, Visit);
+		}
+
+		bool EditSet(K&& Key, V&& Value)
+		{
+			auto hash = _hash(Key);
+			auto added = EditSet(_root, 0, Entry{ hash, Move(Key), Move(Value) });
+			_size += added;
+			return added;
+		}
+
+		bool EditErase(const K& Key)
+		{
+			if (!Find(Key))
+				return false;
+			EditErase(_root, 0, _hash(Key), Key);
+			if (--_size == 0)
+			{
+				Release(_root);
+				_root = nullptr;
+			}
+			return true;
+		}
+
+	public:
+		using keyType = K;
+		using valueType = V;
+
+		/*
+		* Batch editing mode of a Persistent_Map. Starts sharing every node with its source and edits in place the nodes it
+		* already copied, so a batch of n updates copies each touched node once instead of n times.
+		*/
+		class Transient
+		{
+			Persistent_Map _map;
+
+		public:
+			[[nodiscard]] explicit Transient(const Persistent_Map& Source) : _map(Source)
+			{
+			}
+
+			/*
+			* Returns whether Key was new.
+			*/
+			bool Set(K Key, V Value)
+			{
+				return _map.EditSet(Move(Key), Move(Value));
+			}
+
+			/*
+			* Returns whether Key was present.
+			*/
+			bool Erase(const K& Key)
+			{
+				return _map.EditErase(Key);
+			}
+
+			const V* Find(const K& Key) const
+			{
+				return _map.Find(Key);
+			}
+
+			size_t Size() const noexcept
+			{
+				return _map.Size();
+			}
+
+			/*
+			* The current contents as a version. Later edits copy the nodes it shares again, leaving it untouched.
+			*/
+			[[nodiscard]] Persistent_Map Persistent() const noexcept
+			{
+				return _map;
+			}
+		};
+
+		[[nodiscard]] explicit Persistent_Map(const Hash& Hasher = Hash(), const Key_Equal& Equal = Key_Equal()) : _hash(Hasher), _equal(Equal)
+		{
+		}
+
+		[[nodiscard]] Persistent_Map(const Persistent_Map& Ref) : _root(Retain(Ref._root)), _size(Ref._size), _hash(Ref._hash), _equal(Ref._equal)
+		{
+		}
+
+		[[nodiscard]] Persistent_Map(Persistent_Map&& Rvr) noexcept : _root(Rvr._root), _size(Rvr._size), _hash(Move(Rvr._hash)), _equal(Move(Rvr._equal))
+		{
+			Rvr._root = nullptr;
+			Rvr._size = 0;
+		}
+
+		~Persistent_Map()
+		{
+			Release(_root);
+		}
+
+		Persistent_Map& operator =(const Persistent_Map& Ref)
+		{
+			Persistent_Map(Ref).Swap(*this);
+			return *this;
+		}
+
+		Persistent_Map& operator =(Persistent_Map&& Rvr) noexcept
+		{
+			Persistent_Map(Move(Rvr)).Swap(*this);
+			return *this;
+		}
+
+		void Swap(Persistent_Map& Ref) noexcept
+		{
+			auto root = _root;
+			auto size = _size;
+			_root = Ref._root;
+			_size = Ref._size;
+			Ref._root = root;
+			Ref._size = size;
+
+			auto hash = Move(_hash);
+			_hash = Move(Ref._hash);
+			Ref._hash = Move(hash);
+			auto equal = Move(_equal);
+			_equal = Move(Ref._equal);
+			Ref._equal = Move(equal);
+		}
+
+		/*
+		* Returns the version mapping Key to Value.
+		*/
+		[[nodiscard]] Persistent_Map Set(K Key, V Value) const
+		{
+			auto version = *this;
+			version.EditSet(Move(Key), Move(Value));
+			return version;
+		}
+
+		/*
+		* Returns the version without Key, sharing everything with this one if Key is absent.
+		*/
+		[[nodiscard]] Persistent_Map Erase(const K& Key) const
+		{
+			auto version = *this;
+			version.EditErase(Key);
+			return version;
+		}
+
+		[[nodiscard]] Transient MakeTransient() const
+		{
+			return Transient(*this);
+		}
+
+		/*
+		* Returns the value mapped to Key, nullptr if there is none. Valid as long as a version sharing its node is alive.
+		*/
+		const V* Find(const K& Key) const
+		{
+			auto hash = _hash(Key);
+			const Node* node = _root;
+			for (uint32_t shift = 0; node; shift += bits)
+			{
+				if (node->collision)
+				{
+					for (auto& entry : node->entries)
+					{
+						if (_equal(entry.key, Key))
+							return &entry.value;
+					}
+					return nullptr;
+				}
+
+				auto bit = Fragment(hash, shift);
+				if (node->dataMap & bit)
+				{
+					auto& entry = node->entries[IndexOf(node->dataMap, bit)];
+					return entry.hash == hash && _equal(entry.key, Key) ? &entry.value : nullptr;
+				}
+				if (!(node->nodeMap & bit))
+					return nullptr;
+				node = node->children[IndexOf(node->nodeMap, bit)];
+			}
+			return nullptr;
+		}
+
+		bool Contains(const K& Key) const
+		{
+			return Find(Key) != nullptr;
+		}
+
+		/*
+		* Calls Visit with every key and value, in no particular order.
+		*/
+		template <typename Function>
+		void ForEach(Function Visit) const
+		{
+			if (_root)
+				ForEach(_root, Visit);
+		}
+
+		size_t Size() const noexcept
+		{
+			return _size;
+		}
+
+		bool Empty() const noexcept
+		{
+			return _size == 0;
+		}
+	};
+#pragma endregion Persistent_Map
+}
+
+#endif PERSISTENT_MAP_H
\ No newline at end of file
@@ -0,0 +1,442 @@
+#ifndef PERSISTENT_VECTOR_H
+#define PERSISTENT_VECTOR_H
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Persistent_Vector
+	/*
+	* Immutable vector whose versions share structure: a 32-way radix-balanced trie of leaves plus a separate tail leaf (Bagwell, Hickey).
+	* PushBack, PopBack and Set return a new version and copy only the O(log32 n) nodes on one path, usually just the tail.
+	* Nodes are reference counted with atomics, so versions can be read, copied and dropped from any thread.
+	* A Transient edits nodes no other version uses in place, for batches of updates; it is used by one thread at a time.
+	* @param T [Element type, copied when a shared leaf is edited].
+	*/
+	template <typename T>
+	class Persistent_Vector
+	{
+		static constexpr uint32_t bits = 5;
+		static constexpr uint32_t width = 1u << bits;
+		static constexpr uint32_t mask = width - 1;
+
+		struct Node
+		{
+			std::atomic<uint32_t> references{ 1 };
+		};
+
+		struct Branch : Node
+		{
+			//Filled from the front, null after the last child.
+			Node* children[width] = {};
+		};
+
+		struct Leaf : Node
+		{
+			uint32_t size = 0;
+			alignas(T) unsigned char storage[width * sizeof(T)];
+
+			T* Items() noexcept
+			{
+				return reinterpret_cast<T*>(storage);
+			}
+
+			const T* Items() const noexcept
+			{
+				return reinterpret_cast<const T*>(storage);
+			}
+
+			~Leaf()
+			{
+				for (uint32_t i = 0; i < size; i++)
+					Items()[i].~T();
+			}
+		};
+
+		Node* _root = nullptr;
+		Leaf* _tail = nullptr;
+		size_t _size = 0;
+		uint32_t _shift = bits;
+
+		static Node* Retain(Node* Target) noexcept
+		{
+			if (Target)
+				Target->references.fetch_add(1, std::memory_order_relaxed);
+			return Target;
+		}
+
+		/*
+		* Drops a reference to Target, a leaf at Level 0 and a branch above it.
+		*/
+		static void Release(Node* Target, uint32_t Level) noexcept
+		{
+			if (!Target || Target->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+				return;
+			if (Level == 0)
+				delete static_cast<Leaf*>(Target);
+			else
+			{
+				auto branch = static_cast<Branch*>(Target);
+				for (auto child : branch->children)
+					Release(child, Level - bits);
+				delete branch;
+			}
+		}
+
+		/*
+		* Makes the leaf in Slot safe to edit: it is only copied when another version or Transient also uses it.
+		*/
+		static Leaf* UniqueLeaf(Node*& Slot)
+		{
+			auto leaf = static_cast<Leaf*>(Slot);
+			if (leaf->references.load(std::memory_order_acquire) == 1)
+				return leaf;
+			auto copy = new Leaf();
+			for (; copy->size < leaf->size; copy->size++)
+				new (copy->Items() + copy->size) T(leaf->Items()[copy->size]);
+			Release(leaf, 0);
+			Slot = copy;
+			return copy;
+		}
+
+		static Branch* UniqueBranch(Node*& Slot, uint32_t Level)
+		{
+			auto branch = static_cast<Branch*>(Slot);
+			if (branch->references.load(std::memory_order_acquire) == 1)
+				return branch;
+			auto copy = new Branch();
+			for (uint32_t i = 0; i < width; i++)
+				copy->children[i] = Retain(branch->children[i]);
+			Release(branch, Level);
+			Slot = copy;
+			return copy;
+		}
+
+		Leaf* UniqueTail()
+		{
+			Node* tail = _tail;
+			UniqueLeaf(tail);
+			return _tail = static_cast<Leaf*>(tail);
+		}
+
+		static Node* NewPath(uint32_t Level, Leaf* Tail)
+		{
+			if (Level == 0)
+				return Tail;
+			auto branch = new Branch();
+			branch->children[0] = NewPath(Level - bits, Tail);
+			return branch;
+		}
+
+		size_t TailOffset() const noexcept
+		{
+			return _size - (_tail ? _tail->size : 0);
+		}
+
+		/*
+		* Moves the full tail into the trie, growing it by a level when it is full.
+		*/
+		void PushTail()
+		{
+			auto index = _size - width;
+			if (!_root)
+			{
+				_root = NewPath(bits, _tail);
+				return;
+			}
+			if ((index >> bits) >= (size_t(1) << _shift))
+			{
+				auto root = new Branch();
+				root->children[0] = _root;
+				root->children[1] = NewPath(_shift, _tail);
+				_root = root;
+				_shift += bits;
+				return;
+			}
+			auto slot = &_root;
+			for (auto level = _shift;; level -= bits)
+			{
+				auto& child = UniqueBranch(*slot, level)->children[(index >> level) & mask];
+				if (!child)
+				{
+					child = NewPath(level - bits, _tail);
+					return;
+				}
+				slot = &child;
+			}
+		}
+
+		/*
+		* Takes the last leaf out of the subtrie in Slot, emptied branches included. Index is the last element's index.
+		*/
+		static Leaf* PopTail(Node*& Slot, uint32_t Level, size_t Index)
+		{
+			auto& child = UniqueBranch(Slot, Level)->children[(Index >> Level) & mask];
+			if (Level == bits)
+			{
+				auto leaf = static_cast<Leaf*>(child);
+				child = nullptr;
+				return leaf;
+			}
+			auto leaf = PopTail(child, Level - bits, Index);
+			if (!static_cast<Branch*>(child)->children[0])
+			{
+				Release(child, Level - bits);
+				child = nullptr;
+			}
+			return leaf;
+		}
+
+		void EditPushBack(T&& Value)
+		{
+			if (_tail && _tail->size == width)
+			{
+				PushTail();
+				_tail = nullptr;
+			}
+			auto tail = _tail ? UniqueTail() : (_tail = new Leaf());
+			new (tail->Items() + tail->size) T(Move(Value));
+			tail->size++;
+			_size++;
+		}
+
+		void EditPopBack()
+		{
+			if (_tail->size > 1 || !_root)
+			{
+				auto tail = UniqueTail();
+				tail->Items()[--tail->size].~T();
+				if (--_size == 0)
+				{
+					Release(_tail, 0);
+					_tail = nullptr;
+				}
+				return;
+			}
+
+			Release(_tail, 0);
+			_size--;
+			_tail = PopTail(_root, _shift, _size - 1);
+			auto root = static_cast<Branch*>(_root);
+			if (!root->children[0])
+			{
+				Release(_root, _shift);
+				_root = nullptr;
+				_shift = bits;
+			}
+			else if (_shift > bits && !root->children[1])
+			{
+				auto child = Retain(root->children[0]);
+				Release(_root, _shift);
+				_root = child;
+				_shift -= bits;
+			}
+		}
+
+		void EditSet(size_t Index, T&& Value)
+		{
+			if (Index >= TailOffset())
+			{
+				UniqueTail()->Items()[Index & mask] = Move(Value);
+				return;
+			}
+			auto slot = &_root;
+			for (auto level = _shift; level > 0; level -= bits)
+				slot = &UniqueBranch(*slot, level)->children[(Index >> level) & mask];
+			UniqueLeaf(*slot)->Items()[Index & mask] = Move(Value);
+		}
+
+		template <typename Function>
+		static void ForEach(const Node* Target, uint32_t Level, Function& Visit)
+		{
+			if (Level == 0)
+			{
+				auto leaf = static_cast<const Leaf*>(Target);
+				for (uint32_t i = 0; i < leaf->size; i++)
+					Visit(leaf->Items()[i]);
+				return;
+			}
+			for (auto child : static_cast<const Branch*>(Target)->children)
+			{
+				if (!child)
+					return;
+				ForEach(child, Level - bits, Visit);
+			}
+		}
+
+	public:
+		using valueType = T;
+
+		/*
+		* Batch editing mode of a Persistent_Vector. Starts sharing every node with its source and edits in place the nodes it
+		* already copied, so a batch of n updates copies each touched node once instead of n times.
+		*/
+		class Transient
+		{
+			Persistent_Vector _vector;
+
+		public:
+			[[nodiscard]] explicit Transient(const Persistent_Vector& Source) : _vector(Source)
+			{
+			}
+
+			void PushBack(T Value)
+			{
+				_vector.EditPushBack(Move(Value));
+			}
+
+			void PopBack()
+			{
+				_vector.EditPopBack();
+			}
+
+			void Set(size_t Index, T Value)
+			{
+				_vector.EditSet(Index, Move(Value));
+			}
+
+			const T& operator [](size_t Index) const noexcept
+			{
+				return _vector[Index];
+			}
+
+			size_t Size() const noexcept
+			{
+				return _vector.Size();
+			}
+
+			/*
+			* The current contents as a version. Later edits copy the nodes it shares again, leaving it untouched.
+			*/
+			[[nodiscard]] Persistent_Vector Persistent() const noexcept
+			{
+				return _vector;
+			}
+		};
+
+		[[nodiscard]] Persistent_Vector() noexcept
+		{
+		}
+
+		[[nodiscard]] Persistent_Vector(const Persistent_Vector& Ref) noexcept : _root(Retain(Ref._root)), _tail(static_cast<Leaf*>(Retain(Ref._tail))), _size(Ref._size), _shift(Ref._shift)
+		{
+		}
+
+		[[nodiscard]] Persistent_Vector(Persistent_Vector&& Rvr) noexcept : _root(Rvr._root), _tail(Rvr._tail), _size(Rvr._size), _shift(Rvr._shift)
+		{
+			Rvr._root = nullptr;
+			Rvr._tail = nullptr;
+			Rvr._size = 0;
+			Rvr._shift = bits;
+		}
+
+		~Persistent_Vector()
+		{
+			Release(_root, _shift);
+			Release(_tail, 0);
+		}
+
+		Persistent_Vector& operator =(const Persistent_Vector& Ref) noexcept
+		{
+			Persistent_Vector(Ref).Swap(*this);
+			return *this;
+		}
+
+		Persistent_Vector& operator =(Persistent_Vector&& Rvr) noexcept
+		{
+			Persistent_Vector(Move(Rvr)).Swap(*this);
+			return *this;
+		}
+
+		void Swap(Persistent_Vector& Ref) noexcept
+		{
+			auto root = _root;
+			auto tail = _tail;
+			auto size = _size;
+			auto shift = _shift;
+			_root = Ref._root;
+			_tail = Ref._tail;
+			_size = Ref._size;
+			_shift = Ref._shift;
+			Ref._root = root;
+			Ref._tail = tail;
+			Ref._size = size;
+			Ref._shift = shift;
+		}
+
+		[[nodiscard]] Persistent_Vector PushBack(T Value) const
+		{
+			auto version = *this;
+			version.EditPushBack(Move(Value));
+			return version;
+		}
+
+		/*
+		* Returns the version without the last element. Must not be empty.
+		*/
+		[[nodiscard]] Persistent_Vector PopBack() const
+		{
+			auto version = *this;
+			version.EditPopBack();
+			return version;
+		}
+
+		[[nodiscard]] Persistent_Vector Set(size_t Index, T Value) const
+		{
+			auto version = *this;
+			version.EditSet(Index, Move(Value));
+			return version;
+		}
+
+		[[nodiscard]] Transient MakeTransient() const noexcept
+		{
+			return Transient(*this);
+		}
+
+		const T& operator [](size_t Index) const noexcept
+		{
+			if (Index >= TailOffset())
+				return _tail->Items()[Index & mask];
+			const Node* node = _root;
+			for (auto level = _shift; level > 0; level -= bits)
+				node = static_cast<const Branch*>(node)->children[(Index >> level) & mask];
+			return static_cast<const Leaf*>(node)->Items()[Index & mask];
+		}
+
+		const T& Back() const noexcept
+		{
+			return _tail->Items()[_tail->size - 1];
+		}
+
+		/*
+		* Calls Visit with every element in order, a leaf at a time.
+		*/
+		template <typename Function>
+		void ForEach(Function Visit) const
+		{
+			if (_root)
+				ForEach(_root, _shift, Visit);
+			if (_tail)
+				ForEach(_tail, 0, Visit);
+		}
+
+		size_t Size() const noexcept
+		{
+			return _size;
+		}
+
+		bool Empty() const noexcept
+		{
+			return _size == 0;
+		}
+	};
+#pragma endregion Persistent_Vector
+}
+
+#endif PERSISTENT_VECTOR_H
\ No newline at end of file
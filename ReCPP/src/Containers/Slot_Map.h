@@ -0,0 +1,262 @@
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Slot_Map
+	/*
+	* 64-bit generational reference into a Slot_Map<T>: a slot index and the generation the slot had when the value was inserted.
+	* Default constructed handles refer to nothing.
+	* @param T [Type of the Slot_Map's values, keeps handles of different maps apart].
+	*/
+	template <typename T>
+	class Handle
+	{
+		template <typename> friend class Slot_Map;
+
+		uint64_t _value = 0;
+
+		[[nodiscard]] Handle(uint32_t Index, uint32_t Generation) noexcept : _value((uint64_t(Generation) << 32) | Index)
+		{
+		}
+
+	public:
+		[[nodiscard]] Handle() noexcept
+		{
+		}
+
+		uint32_t Index() const noexcept
+		{
+			return uint32_t(_value);
+		}
+
+		uint32_t Generation() const noexcept
+		{
+			return uint32_t(_value >> 32);
+		}
+
+		uint64_t Value() const noexcept
+		{
+			return _value;
+		}
+
+		bool Valid() const noexcept //Says nothing about staleness, see Slot_Map::Contains.
+		{
+			return _value != 0;
+		}
+
+		bool operator ==(const Handle& Other) const noexcept
+		{
+			return _value == Other._value;
+		}
+
+		bool operator !=(const Handle& Other) const noexcept
+		{
+			return _value != Other._value;
+		}
+	};
+
+	/*
+	* Stores values densely for iteration and hands out generational handles. Insert, Erase and lookups are O(1);
+	* a handle whose value was erased is detected by its generation and never resolves to a newer value in the same slot.
+	* Erase moves the last value into the hole, so value addresses and iteration order are not stable.
+	* @param T [Stored type, must be move assignable].
+	*/
+	template <typename T>
+	class Slot_Map
+	{
+		static constexpr uint32_t no_slot = ~uint32_t(0);
+
+		struct Slot
+		{
+			uint32_t index; //Dense index while occupied, next free slot otherwise.
+			uint32_t generation; //Starts at 1 so the null handle never matches, bumped by every erase.
+		};
+
+		std::vector<T> _values;
+		std::vector<uint32_t> _valueSlots; //Slot of every dense value, for fixing up the slot of the value moved by Erase.
+		std::vector<Slot> _slots;
+		uint32_t _freeHead = no_slot;
+
+		const Slot* Find(Handle<T> Target) const noexcept
+		{
+			auto index = Target.Index();
+			if (index >= _slots.size() || Target.Generation() == 0) //Null handles, and retired slots whose generation wrapped to 0.
+				return nullptr;
+			auto& slot = _slots[index];
+			return slot.generation == Target.Generation() ? &slot : nullptr;
+		}
+
+		void Free(uint32_t SlotIndex)
+		{
+			auto& slot = _slots[SlotIndex];
+			if (++slot.generation == 0) //Retire slots whose generation ran out instead of reissuing old handles.
+				return;
+			slot.index = _freeHead;
+			_freeHead = SlotIndex;
+		}
+
+	public:
+		using valueType = T;
+		using handleType = Handle<T>;
+
+		[[nodiscard]] Slot_Map()
+		{
+		}
+
+		void Reserve(size_t Capacity)
+		{
+			_values.reserve(Capacity);
+			_valueSlots.reserve(Capacity);
+			_slots.reserve(Capacity);
+		}
+
+		/*
+		* Constructs a value from Arguments at the end of the dense storage and returns its handle.
+		*/
+		template <typename... ArgT>
+		Handle<T> Insert(ArgT&&... Arguments)
+		{
+			uint32_t slotIndex;
+			if (_freeHead != no_slot)
+			{
+				slotIndex = _freeHead;
+				_freeHead = _slots[slotIndex].index;
+			}
+			else
+			{
+				slotIndex = uint32_t(_slots.size());
+				_slots.push_back(Slot{ 0, 1 });
+			}
+
+			_values.emplace_back(Forward<ArgT>(Arguments)...);
+			_valueSlots.push_back(slotIndex);
+			auto& slot = _slots[slotIndex];
+			slot.index = uint32_t(_values.size() - 1);
+			return Handle<T>(slotIndex, slot.generation);
+		}
+
+		/*
+		* Destroys the value Target refers to, filling its place with the last value. Returns false for stale handles.
+		*/
+		bool Erase(Handle<T> Target)
+		{
+			auto slot = Find(Target);
+			if (!slot)
+				return false;
+
+			auto index = slot->index;
+			auto last = uint32_t(_values.size() - 1);
+			if (index != last)
+			{
+				_values[index] = Move(_values[last]);
+				_valueSlots[index] = _valueSlots[last];
+				_slots[_valueSlots[index]].index = index;
+			}
+			_values.pop_back();
+			_valueSlots.pop_back();
+			Free(Target.Index());
+			return true;
+		}
+
+		/*
+		* Erases every value, invalidating all handles handed out so far.
+		*/
+		void Clear()
+		{
+			for (auto slotIndex : _valueSlots)
+				Free(slotIndex);
+			_values.clear();
+			_valueSlots.clear();
+		}
+
+		bool Contains(Handle<T> Target) const noexcept
+		{
+			return Find(Target) != nullptr;
+		}
+
+		/*
+		* Returns nullptr if Target is stale.
+		*/
+		T* Get(Handle<T> Target) noexcept
+		{
+			auto slot = Find(Target);
+			return slot ? &_values[slot->index] : nullptr;
+		}
+
+		const T* Get(Handle<T> Target) const noexcept
+		{
+			auto slot = Find(Target);
+			return slot ? &_values[slot->index] : nullptr;
+		}
+
+		/*
+		* Handle of the value at Index in the dense storage.
+		*/
+		Handle<T> HandleAt(size_t Index) const noexcept
+		{
+			auto slotIndex = _valueSlots[Index];
+			return Handle<T>(slotIndex, _slots[slotIndex].generation);
+		}
+
+		size_t Size() const noexcept
+		{
+			return _values.size();
+		}
+
+		bool Empty() const noexcept
+		{
+			return _values.empty();
+		}
+
+		T* Data() noexcept
+		{
+			return _values.data();
+		}
+
+		const T* Data() const noexcept
+		{
+			return _values.data();
+		}
+
+		T& operator [](size_t Index) noexcept //Dense index, not a handle.
+		{
+			return _values[Index];
+		}
+
+		const T& operator [](size_t Index) const noexcept
+		{
+			return _values[Index];
+		}
+
+		T* begin() noexcept
+		{
+			return _values.data();
+		}
+
+		T* end() noexcept
+		{
+			return _values.data() + _values.size();
+		}
+
+		const T* begin() const noexcept
+		{
+			return _values.data();
+		}
+
+		const T* end() const noexcept
+		{
+			return _values.data() + _values.size();
+		}
+	};
+#pragma endregion Slot_Map
+}
+
+#endif SLOT_MAP_H
\ No newline at end of file
@@ -0,0 +1,378 @@
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Small_Vector
+	/*
+	* Growable array keeping up to N elements inline, spilling to the heap beyond that.
+	* Trivially relocatable elements (see is_trivially_relocatable) are relocated with memcpy/memmove, others are move constructed and destroyed one by one.
+	* Growing or moving relocates elements, so pointers into the vector don't survive it.
+	* @param T [Element type].
+	* @param N [Number of elements stored without a heap allocation].
+	*/
+	template <typename T, size_t N>
+	class Small_Vector
+	{
+		static constexpr bool trivial = is_trivially_copyable_v<T>;
+		static constexpr bool relocatable = is_trivially_relocatable_v<T>;
+		static constexpr bool over_aligned = alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__; //Needs the aligned operator new.
+
+		T* _data;
+		size_t _size = 0;
+		size_t _capacity = N;
+		alignas(T) unsigned char _inline[(N > 0 ? N : 1) * sizeof(T)];
+
+		T* InlineData() noexcept
+		{
+			return reinterpret_cast<T*>(_inline);
+		}
+
+		/*
+		* Moves Count elements from Source into uninitialized Target and destroys the originals.
+		*/
+		static void Relocate(T* Target, T* Source, size_t Count) noexcept
+		{
+			if constexpr (relocatable)
+			{
+				if (Count)
+					memcpy(static_cast<void*>(Target), static_cast<const void*>(Source), Count * sizeof(T));
+			}
+			else
+			{
+				for (size_t i = 0; i < Count; i++)
+				{
+					new (Target + i) T(Move(Source[i]));
+					Source[i].~T();
+				}
+			}
+		}
+
+		static void Destroy(T* Begin, T* End) noexcept
+		{
+			if constexpr (!trivial)
+			{
+				for (; Begin != End; Begin++)
+					Begin->~T();
+			}
+		}
+
+		void FreeHeap() noexcept
+		{
+			if (IsInline())
+				return;
+			if constexpr (over_aligned)
+				::operator delete(static_cast<void*>(_data), std::align_val_t(alignof(T)));
+			else
+				::operator delete(static_cast<void*>(_data));
+		}
+
+		size_t NextCapacity(size_t Required) const noexcept
+		{
+			auto capacity = _capacity * 2;
+			return capacity < Required ? Required : capacity;
+		}
+
+		T* Allocate(size_t Capacity)
+		{
+			if constexpr (over_aligned)
+				return static_cast<T*>(::operator new(Capacity * sizeof(T), std::align_val_t(alignof(T))));
+			else
+				return static_cast<T*>(::operator new(Capacity * sizeof(T)));
+		}
+
+		void Grow(size_t Capacity)
+		{
+			auto data = Allocate(Capacity);
+			Relocate(data, _data, _size);
+			FreeHeap();
+			_data = data;
+			_capacity = Capacity;
+		}
+
+		void TakeStorage(Small_Vector& Rvr) noexcept
+		{
+			if (Rvr.IsInline())
+			{
+				Relocate(_data, Rvr._data, Rvr._size);
+				_size = Rvr._size;
+			}
+			else
+			{
+				_data = Rvr._data;
+				_size = Rvr._size;
+				_capacity = Rvr._capacity;
+				Rvr._data = Rvr.InlineData();
+				Rvr._capacity = N;
+			}
+			Rvr._size = 0;
+		}
+
+	public:
+		using valueType = T;
+
+		[[nodiscard]] Small_Vector() noexcept : _data(InlineData())
+		{
+		}
+
+		[[nodiscard]] Small_Vector(std::initializer_list<T> List) : _data(InlineData())
+		{
+			Reserve(List.size());
+			for (auto& item : List)
+				new (_data + _size++) T(item);
+		}
+
+		[[nodiscard]] explicit Small_Vector(size_t Size) : _data(InlineData())
+		{
+			Resize(Size);
+		}
+
+		[[nodiscard]] Small_Vector(const Small_Vector& Ref) : _data(InlineData())
+		{
+			Reserve(Ref._size);
+			if constexpr (trivial)
+			{
+				if (Ref._size)
+					memcpy(static_cast<void*>(_data), static_cast<const void*>(Ref._data), Ref._size * sizeof(T));
+				_size = Ref._size;
+			}
+			else
+			{
+				for (; _size < Ref._size; _size++)
+					new (_data + _size) T(Ref._data[_size]);
+			}
+		}
+
+		[[nodiscard]] Small_Vector(Small_Vector&& Rvr) noexcept : _data(InlineData())
+		{
+			TakeStorage(Rvr);
+		}
+
+		~Small_Vector()
+		{
+			Destroy(_data, _data + _size);
+			FreeHeap();
+		}
+
+		Small_Vector& operator =(const Small_Vector& Ref)
+		{
+			if (this != &Ref)
+			{
+				Small_Vector copy(Ref);
+				*this = Move(copy);
+			}
+			return *this;
+		}
+
+		Small_Vector& operator =(Small_Vector&& Rvr) noexcept
+		{
+			if (this != &Rvr)
+			{
+				Clear();
+				FreeHeap();
+				_data = InlineData();
+				_capacity = N;
+				TakeStorage(Rvr);
+			}
+			return *this;
+		}
+
+		void Reserve(size_t Capacity)
+		{
+			if (Capacity > _capacity)
+				Grow(Capacity);
+		}
+
+		/*
+		* Shrinks by destroying trailing elements or grows by value-initializing new ones.
+		*/
+		void Resize(size_t Size)
+		{
+			if (Size < _size)
+			{
+				Destroy(_data + Size, _data + _size);
+				_size = Size;
+				return;
+			}
+			Reserve(Size);
+			for (; _size < Size; _size++)
+				new (_data + _size) T();
+		}
+
+		template <typename... ArgT>
+		T& EmplaceBack(ArgT&&... Arguments)
+		{
+			if (_size == _capacity)
+			{
+				//The new element is constructed before relocating, Arguments may refer to elements of this vector.
+				auto capacity = NextCapacity(_size + 1);
+				auto data = Allocate(capacity);
+				new (data + _size) T(Forward<ArgT>(Arguments)...);
+				Relocate(data, _data, _size);
+				FreeHeap();
+				_data = data;
+				_capacity = capacity;
+			}
+			else
+				new (_data + _size) T(Forward<ArgT>(Arguments)...);
+			return _data[_size++];
+		}
+
+		void PushBack(const T& Value)
+		{
+			EmplaceBack(Value);
+		}
+
+		void PushBack(T&& Value)
+		{
+			EmplaceBack(Move(Value));
+		}
+
+		void PopBack() noexcept
+		{
+			_data[--_size].~T();
+		}
+
+		/*
+		* Constructs an element at Index, shifting the following ones up.
+		*/
+		template <typename... ArgT>
+		T& Emplace(size_t Index, ArgT&&... Arguments)
+		{
+			if (Index == _size)
+				return EmplaceBack(Forward<ArgT>(Arguments)...);
+
+			T value(Forward<ArgT>(Arguments)...);
+			if (_size == _capacity)
+				Grow(NextCapacity(_size + 1));
+			if constexpr (relocatable)
+				memmove(static_cast<void*>(_data + Index + 1), static_cast<const void*>(_data + Index), (_size - Index) * sizeof(T));
+			else
+			{
+				new (_data + _size) T(Move(_data[_size - 1]));
+				for (size_t i = _size - 1; i > Index; i--)
+					_data[i] = Move(_data[i - 1]);
+				_data[Index].~T();
+			}
+			new (_data + Index) T(Move(value));
+			_size++;
+			return _data[Index];
+		}
+
+		/*
+		* Destroys the element at Index, shifting the following ones down.
+		*/
+		void Erase(size_t Index) noexcept
+		{
+			if constexpr (relocatable)
+			{
+				_data[Index].~T();
+				memmove(static_cast<void*>(_data + Index), static_cast<const void*>(_data + Index + 1), (_size - Index - 1) * sizeof(T));
+			}
+			else
+			{
+				for (size_t i = Index; i + 1 < _size; i++)
+					_data[i] = Move(_data[i + 1]);
+				_data[_size - 1].~T();
+			}
+			_size--;
+		}
+
+		void Clear() noexcept
+		{
+			Destroy(_data, _data + _size);
+			_size = 0;
+		}
+
+		bool IsInline() const noexcept
+		{
+			return _data == reinterpret_cast<const T*>(_inline);
+		}
+
+		size_t Size() const noexcept
+		{
+			return _size;
+		}
+
+		size_t Capacity() const noexcept
+		{
+			return _capacity;
+		}
+
+		bool Empty() const noexcept
+		{
+			return _size == 0;
+		}
+
+		T* Data() noexcept
+		{
+			return _data;
+		}
+
+		const T* Data() const noexcept
+		{
+			return _data;
+		}
+
+		T& Front() noexcept
+		{
+			return _data[0];
+		}
+
+		const T& Front() const noexcept
+		{
+			return _data[0];
+		}
+
+		T& Back() noexcept
+		{
+			return _data[_size - 1];
+		}
+
+		const T& Back() const noexcept
+		{
+			return _data[_size - 1];
+		}
+
+		T& operator [](size_t Index) noexcept
+		{
+			return _data[Index];
+		}
+
+		const T& operator [](size_t Index) const noexcept
+		{
+			return _data[Index];
+		}
+
+		T* begin() noexcept
+		{
+			return _data;
+		}
+
+		T* end() noexcept
+		{
+			return _data + _size;
+		}
+
+		const T* begin() const noexcept
+		{
+			return _data;
+		}
+
+		const T* end() const noexcept
+		{
+			return _data + _size;
+		}
+	};
+#pragma endregion Small_Vector
+}
+
+#endif SMALL_VECTOR_H
\ No newline at end of file
@@ -0,0 +1,149 @@
+#ifndef BIND_H
+#define BIND_H
+
+#pragma once
+
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Placeholders
+	/*
+	* Marks a Bind argument that gets replaced by the N-th (1-based) argument of the call.
+	*/
+	template <size_t N>
+	struct Placeholder
+	{
+		static_assert(N > 0, "Placeholders are 1-based.");
+	};
+
+	namespace Placeholders
+	{
+		static constexpr Placeholder<1> _1{};
+		static constexpr Placeholder<2> _2{};
+		static constexpr Placeholder<3> _3{};
+		static constexpr Placeholder<4> _4{};
+		static constexpr Placeholder<5> _5{};
+		static constexpr Placeholder<6> _6{};
+		static constexpr Placeholder<7> _7{};
+		static constexpr Placeholder<8> _8{};
+	}
+
+	template <typename T>
+	struct is_placeholder
+	{
+		static constexpr size_t value = 0;
+	};
+
+	template <size_t N>
+	struct is_placeholder<Placeholder<N>>
+	{
+		static constexpr size_t value = N;
+	};
+
+	template <typename T>
+	static constexpr size_t is_placeholder_v = is_placeholder<remove_cv_t<T>>::value;
+#pragma endregion Placeholders
+
+#pragma region Bind_Storage
+	template <size_t Index, typename T>
+	struct Bind_Element
+	{
+		T value;
+	};
+
+	/*
+	* Flat tuple-like storage: every element is a direct base, so the layout is the same as a plain struct of the elements.
+	*/
+	template <typename Sequence, typename... T>
+	struct Bind_Storage;
+
+	template <size_t... Indices, typename... T>
+	struct Bind_Storage<index_sequence<Indices...>, T...> : Bind_Element<Indices, T>...
+	{
+	};
+
+	template <size_t Index, typename T>
+	constexpr T& Get_Element(Bind_Element<Index, T>& Element) noexcept
+	{
+		return Element.value;
+	}
+
+	template <size_t Index, typename T>
+	constexpr const T& Get_Element(const Bind_Element<Index, T>& Element) noexcept
+	{
+		return Element.value;
+	}
+
+	template <size_t Index, typename T>
+	constexpr T&& Forward_Element(Bind_Element<Index, T>& Element) noexcept
+	{
+		return Forward<T>(Element.value);
+	}
+#pragma endregion Bind_Storage
+
+#pragma region Binder
+	/*
+	* Callable produced by Bind. Bound arguments are stored inline; placeholders are substituted with the call's arguments.
+	* @param Callable [Decayed type of the target callable].
+	* @param BoundT [Decayed types of the bound arguments].
+	*/
+	template <typename Callable, typename... BoundT>
+	class Binder
+	{
+		Callable _target;
+		Bind_Storage<make_index_sequence<sizeof...(BoundT)>, BoundT...> _bound;
+
+		template <typename BoundType, typename CallArgs>
+		static constexpr decltype(auto) Select(BoundType& Bound, CallArgs& Args) noexcept
+		{
+			if constexpr (is_placeholder_v<BoundType> > 0)
+				return Forward_Element<is_placeholder_v<BoundType> - 1>(Args);
+			else
+				return (Bound);
+		}
+
+		template <typename Self, size_t... Indices, typename CallArgs>
+		static decltype(auto) Invoke(Self& This, index_sequence<Indices...>, CallArgs& Args)
+		{
+			return This._target(Select(Get_Element<Indices>(This._bound), Args)...);
+		}
+
+	public:
+		template <typename CallableT, typename... BoundArgT, enable_if_t<!is_same_v<decay_t<CallableT>, Binder>, bool> = false>
+		Binder(CallableT&& Target, BoundArgT&&... Bound) : _target(Forward<CallableT>(Target)), _bound{ { Forward<BoundArgT>(Bound) }... }
+		{
+		}
+
+		template <typename... CallT>
+		decltype(auto) operator()(CallT&&... Args)
+		{
+			Bind_Storage<make_index_sequence<sizeof...(CallT)>, CallT&&...> callArgs{ { Forward<CallT>(Args) }... };
+			return Invoke(*this, make_index_sequence<sizeof...(BoundT)>(), callArgs);
+		}
+
+		template <typename... CallT>
+		decltype(auto) operator()(CallT&&... Args) const
+		{
+			Bind_Storage<make_index_sequence<sizeof...(CallT)>, CallT&&...> callArgs{ { Forward<CallT>(Args) }... };
+			return Invoke(*this, make_index_sequence<sizeof...(BoundT)>(), callArgs);
+		}
+
+		Binder() = delete;
+	};
+
+	/*
+	* Binds arguments to a callable (Function::Func instances, lambdas, functors and free functions) without allocating.
+	* Bound arguments are copied/moved into the returned Binder; use Placeholders::_1... to forward call arguments.
+	* @param Target [Target callable].
+	* @param Bound [Arguments or placeholders, in the target's parameter order].
+	*/
+	template <typename Callable, typename... BoundArgT>
+	[[nodiscard]] auto Bind(Callable&& Target, BoundArgT&&... Bound) -> Binder<decay_t<Callable>, decay_t<BoundArgT>...>
+	{
+		return Binder<decay_t<Callable>, decay_t<BoundArgT>...>(Forward<Callable>(Target), Forward<BoundArgT>(Bound)...);
+	}
+#pragma endregion Binder
+}
+
+#endif BIND_H
\ No newline at end of file
@@ -3,404 +3,227 @@
 
 #pragma once
 
+#include <cstdint>
 #include "Smart_Pointers.h"
 #include "Type_Traits.h"
 
-//If enabled, function classes initialized with a shared pointer (ACBYTES::Shared_Ptr) will keep a copy of the shared pointer to avoid the function containing class from getting deleted. If initialized using the raw pointer constructor, shared pointer to the class will be initialized as an empty pointer.
-//TODO [Remove the need of a preprocessor by specializing Function to carry these features out.]
-#define SHARED_PTR_FUNCTIONS 0
-
 namespace ACBYTES
 {
 	class Function
 	{
 #pragma region Func
 	public:
-		enum class Post_Qualifiers
+		/*
+		* Qualifiers of the wrapped member function, combined with |. NOEXCEPT also applies to non-member functions.
+		*/
+		enum class Post_Qualifiers : uint8_t
 		{
 			//No post_qualifiers
-			NONE,
-			CONST,
-			VOLATILE,
+			NONE = 0,
+			CONST = 1,
+			VOLATILE = 2,
 			//const volatile, LOL
-			CONVOL
+			CONVOL = CONST | VOLATILE,
+			LVALUE_REF = 4,
+			RVALUE_REF = 8,
+			NOEXCEPT = 16
 		};
 
-	private:
+		friend constexpr Post_Qualifiers operator |(Post_Qualifiers Left, Post_Qualifiers Right) noexcept
+		{
+			return static_cast<Post_Qualifiers>(static_cast<uint8_t>(Left) | static_cast<uint8_t>(Right));
+		}
 
-#pragma region RT, CLASS, PQ, ARGT
+		static constexpr bool Has(Post_Qualifiers Qualifiers, Post_Qualifiers Flag) noexcept
+		{
+			return (static_cast<uint8_t>(Qualifiers) & static_cast<uint8_t>(Flag)) == static_cast<uint8_t>(Flag);
+		}
 
 		/*
-		A function wrapper that can deal with static, non-static, and member functions.
-		@param RT [Return type of the function].
-		@param Class [Class type that contains the function].
-		@param PQ [Post-qualifier for member function].
-		@param ArgT [Arguments that should be passed to the function].
+		* How a member Func holds its object.
 		*/
-		template <typename RT, typename Class, Post_Qualifiers PQ = Post_Qualifiers::NONE, typename... ArgT>
-		class Func
+		enum class Func_Binding : uint8_t
 		{
-		public:
-			using funcType = RT(Class::*)(ArgT...);
-
-		private:
-			Class* _class;
-			funcType _funcPtr;
-
-#if SHARED_PTR_FUNCTIONS
-			Shared_Ptr<Class> _shared_class_ptr;
-#endif //SHARED_PTR_FUNCTIONS
-
-		public:
-			Func(Class* ClassPtr, funcType FuncPtr) : _class(ClassPtr), _funcPtr(FuncPtr)
-			{
-			}
-
-#if SHARED_PTR_FUNCTIONS
-			Func(Shared_Ptr<Class>&& ClassPtr, funcType FuncPtr) : _class(ClassPtr.Get()), _funcPtr(FuncPtr), _shared_class_ptr(ACBYTES::Move(ClassPtr))
-			{
-			}
-#endif //SHARED_PTR_FUNCTIONS
-
-			RT operator()(ArgT... Args)
-			{
-				return (_class->*_funcPtr)(Forward<ArgT>(Args)...);
-			}
-
-			Func() = delete;
+			RAW, //A plain pointer, the caller keeps the object alive.
+			STRONG, //A Shared_Ptr, the Func keeps the object alive.
+			WEAK //A Weak_Ptr, calls on a destroyed object are skipped, see TryCall. For subscriptions that shouldn't keep their subscriber alive.
 		};
 
-		/*
-		A function wrapper that can deal with static, non-static, and member functions.
-		@param RT Return type of the function.
-		@param Class [Class type that contains the function].
-		@param ArgT Arguments that should be passed to the function.
-		*/
-		template <typename RT, typename Class, typename... ArgT>
-		class Func<RT, Class, Post_Qualifiers::CONST, ArgT...>
+	private:
+		static constexpr Reference_Qualifier Reference(Post_Qualifiers Qualifiers) noexcept
 		{
-		public:
-			using funcType = RT(Class::*)(ArgT...) const;
-
-		private:
-			Class* _class;
-			funcType _funcPtr;
-
-#if SHARED_PTR_FUNCTIONS
-			Shared_Ptr<Class> _shared_class_ptr;
-#endif //SHARED_PTR_FUNCTIONS
-
-		public:
-			Func(Class* ClassPtr, funcType FuncPtr) : _class(ClassPtr), _funcPtr(FuncPtr)
-			{
-			}
-
-#if SHARED_PTR_FUNCTIONS
-			Func(Shared_Ptr<Class>&& ClassPtr, funcType FuncPtr) : _class(ClassPtr.Get()), _funcPtr(FuncPtr), _shared_class_ptr(Move(ClassPtr))
-			{
-			}
-#endif //SHARED_PTR_FUNCTIONS
+			return Has(Qualifiers, Post_Qualifiers::RVALUE_REF) ? Reference_Qualifier::RVALUE : (Has(Qualifiers, Post_Qualifiers::LVALUE_REF) ? Reference_Qualifier::LVALUE : Reference_Qualifier::NONE);
+		}
 
-			RT operator()(ArgT... Args) const
-			{
-				return (_class->*_funcPtr)(Forward<ArgT>(Args)...);
-			}
+		template <typename Traits>
+		static constexpr Post_Qualifiers QualifiersOf() noexcept
+		{
+			auto qualifiers = Post_Qualifiers::NONE;
+			if (Traits::is_const)
+				qualifiers = qualifiers | Post_Qualifiers::CONST;
+			if (Traits::is_volatile)
+				qualifiers = qualifiers | Post_Qualifiers::VOLATILE;
+			if (Traits::reference == Reference_Qualifier::LVALUE)
+				qualifiers = qualifiers | Post_Qualifiers::LVALUE_REF;
+			if (Traits::reference == Reference_Qualifier::RVALUE)
+				qualifiers = qualifiers | Post_Qualifiers::RVALUE_REF;
+			if (Traits::is_noexcept)
+				qualifiers = qualifiers | Post_Qualifiers::NOEXCEPT;
+			return qualifiers;
+		}
 
-			Func() = delete;
+		template <typename RT, typename Class, Post_Qualifiers PQ, typename... ArgT>
+		struct Func_Pointer
+		{
+			typedef typename member_function_pointer<RT, Class, Has(PQ, Post_Qualifiers::CONST), Has(PQ, Post_Qualifiers::VOLATILE), Reference(PQ), Has(PQ, Post_Qualifiers::NOEXCEPT), ArgT...>::type type;
 		};
 
-		/*
-		A function wrapper that can deal with static, non-static, and member functions.
-		@param RT Return type of the function.
-		@param Class [Class type that contains the function].
-		@param ArgT Arguments that should be passed to the function.
-		*/
-		template <typename RT, typename Class, typename... ArgT>
-		class Func<RT, Class, Post_Qualifiers::VOLATILE, ArgT...>
+		template <typename RT, Post_Qualifiers PQ, typename... ArgT>
+		struct Func_Pointer<RT, void, PQ, ArgT...>
 		{
-		public:
-			using funcType = RT(Class::*)(ArgT...) volatile;
-
-		private:
-			Class* _class;
-			funcType _funcPtr;
-
-#if SHARED_PTR_FUNCTIONS
-			Shared_Ptr<Class> _shared_class_ptr;
-#endif //SHARED_PTR_FUNCTIONS
-
-		public:
-			Func(Class* ClassPtr, funcType FuncPtr) : _class(ClassPtr), _funcPtr(FuncPtr)
-			{
-			}
-
-#if SHARED_PTR_FUNCTIONS
-			Func(Shared_Ptr<Class>&& ClassPtr, funcType FuncPtr) : _class(ClassPtr.Get()), _funcPtr(FuncPtr), _shared_class_ptr(Move(ClassPtr))
-			{
-			}
-#endif //SHARED_PTR_FUNCTIONS
-
-			RT operator()(ArgT... Args) volatile
-			{
-				return (_class->*_funcPtr)(Forward<ArgT>(Args)...);
-			}
-
-			Func() = delete;
+			typedef RT(*type)(ArgT...) noexcept(Has(PQ, Post_Qualifiers::NOEXCEPT));
 		};
 
-		/*
-		A function wrapper that can deal with static, non-static, and member functions.
-		@param RT Return type of the function.
-		@param Class [Class type that contains the function].
-		@param ArgT Arguments that should be passed to the function.
-		*/
-		template <typename RT, typename Class, typename... ArgT>
-		class Func<RT, Class, Post_Qualifiers::CONVOL, ArgT...>
+		struct No_Owner
 		{
-		public:
-			using funcType = RT(Class::*)(ArgT...) const volatile;
-
-		private:
-			Class* _class;
-			funcType _funcPtr;
-
-#if SHARED_PTR_FUNCTIONS
-			Shared_Ptr<Class> _shared_class_ptr;
-#endif //SHARED_PTR_FUNCTIONS
-
-		public:
-			Func(Class* ClassPtr, funcType FuncPtr) : _class(ClassPtr), _funcPtr(FuncPtr)
-			{
-			}
-
-#if SHARED_PTR_FUNCTIONS
-			Func(Shared_Ptr<Class>&& ClassPtr, funcType FuncPtr) : _class(ClassPtr.Get()), _funcPtr(FuncPtr), _shared_class_ptr(Move(ClassPtr))
-			{
-			}
-#endif //SHARED_PTR_FUNCTIONS
-
-			RT operator()(ArgT... Args) volatile
-			{
-				return (_class->*_funcPtr)(Forward<ArgT>(Args)...);
-			}
-
-			Func() = delete;
 		};
 
-#pragma endregion RT, CLASS, PQ, ARGT
-
-#pragma region RT, CLASS, PQ
-
-		/*
-		A function wrapper that can deal with static, non-static, and member functions.
-		@param RT [Return type of the function].
-		@param Class [Class type that contains the function].
-		@param PQ [Post-qualifier for member function].
-		*/
-		template <typename RT, typename Class, Post_Qualifiers PQ>
-		class Func<RT, Class, PQ>
+		template <typename Class, Func_Binding Binding>
+		struct Func_Target
 		{
-		public:
-			using funcType = RT(Class::*)();
-
-		private:
-			Class* _class;
-			funcType _funcPtr;
-
-#if SHARED_PTR_FUNCTIONS
-			Shared_Ptr<Class> _shared_class_ptr;
-#endif // SHARED_PTR_FUNCTIONS
-
-
-		public:
-			Func(Class* ClassPtr, funcType FuncPtr) : _class(ClassPtr), _funcPtr(FuncPtr)
-			{
-			}
-
-#if SHARED_PTR_FUNCTIONS
-			Func(Shared_Ptr<Class>&& ClassPtr, funcType FuncPtr) : _class(ClassPtr.Get()), _funcPtr(FuncPtr), _shared_class_ptr(Move(ClassPtr))
-			{
-			}
-#endif // SHARED_PTR_FUNCTIONS
-
-			RT operator()()
-			{
-				return (_class->*_funcPtr)();
-			}
-
-			Func() = delete;
+			typedef conditional_t<Class*, conditional_t<Shared_Ptr<Class>, Weak_Ptr<Class>, Binding == Func_Binding::STRONG>, Binding == Func_Binding::RAW> type;
 		};
 
-		/*
-		A function wrapper that can deal with static, non-static, and member functions.
-		@param RT [Return type of the function].
-		@param Class [Class type that contains the function].
-		*/
-		template <typename RT, typename Class>
-		class Func<RT, Class, Post_Qualifiers::CONST>
+		template <Func_Binding Binding>
+		struct Func_Target<void, Binding>
 		{
-		public:
-			using funcType = RT(Class::*)() const;
-
-		private:
-			Class* _class;
-			funcType _funcPtr;
-
-#if SHARED_PTR_FUNCTIONS
-			Shared_Ptr<Class> _shared_class_ptr;
-#endif // SHARED_PTR_FUNCTIONS
-
-
-		public:
-			Func(Class* ClassPtr, funcType FuncPtr) : _class(ClassPtr), _funcPtr(FuncPtr)
-			{
-			}
-
-#if SHARED_PTR_FUNCTIONS
-			Func(Shared_Ptr<Class>&& ClassPtr, funcType FuncPtr) : _class(ClassPtr.Get()), _funcPtr(FuncPtr), _shared_class_ptr(Move(ClassPtr))
-			{
-			}
-#endif // SHARED_PTR_FUNCTIONS
-
-			RT operator()() const
-			{
-				return (_class->*_funcPtr)();
-			}
-
-			Func() = delete;
+			typedef No_Owner type;
 		};
 
+	public:
 		/*
 		A function wrapper that can deal with static, non-static, and member functions.
 		@param RT [Return type of the function].
-		@param Class [Class type that contains the function].
+		@param Class [Class type that contains the function, void for non-member functions].
+		@param PQ [Post-qualifiers of the member function].
+		@param Binding [How a member function's object is held, see Func_Binding].
+		@param ArgT [Arguments that should be passed to the function].
 		*/
-		template <typename RT, typename Class>
-		class Func<RT, Class, Post_Qualifiers::VOLATILE>
+		template <typename RT, typename Class, Post_Qualifiers PQ, Func_Binding Binding, typename... ArgT>
+		class Bound_Func
 		{
+			static constexpr bool is_member = !is_same_v<Class, void>;
+			static_assert(is_member || Binding == Func_Binding::RAW, "Non-member functions have no object to bind.");
+
 		public:
-			using funcType = RT(Class::*)() volatile;
+			using funcType = typename Func_Pointer<RT, Class, PQ, ArgT...>::type;
+			using targetType = typename Func_Target<Class, Binding>::type;
 
 		private:
-			Class* _class;
+			NO_UNIQUE_ADDRESS targetType _target;
 			funcType _funcPtr;
 
-#if SHARED_PTR_FUNCTIONS
-			Shared_Ptr<Class> _shared_class_ptr;
-#endif // SHARED_PTR_FUNCTIONS
-
-
-		public:
-			Func(Class* ClassPtr, funcType FuncPtr) : _class(ClassPtr), _funcPtr(FuncPtr)
-			{
-			}
-
-#if SHARED_PTR_FUNCTIONS
-			Func(Shared_Ptr<Class>&& ClassPtr, funcType FuncPtr) : _class(ClassPtr.Get()), _funcPtr(FuncPtr), _shared_class_ptr(Move(ClassPtr))
-			{
-			}
-#endif // SHARED_PTR_FUNCTIONS
-
-			RT operator()() volatile
+			RT Call(Class* Target, ArgT&&... Args) const
 			{
-				return (_class->*_funcPtr)();
+				if constexpr (Has(PQ, Post_Qualifiers::RVALUE_REF))
+					return (ACBYTES::Move(*Target).*_funcPtr)(Forward<ArgT>(Args)...);
+				else
+					return ((*Target).*_funcPtr)(Forward<ArgT>(Args)...);
 			}
 
-			Func() = delete;
-		};
-
-		/*
-		A function wrapper that can deal with static, non-static, and member functions.
-		@param RT [Return type of the function].
-		@param Class [Class type that contains the function].
-		*/
-		template <typename RT, typename Class>
-		class Func<RT, Class, Post_Qualifiers::CONVOL>
-		{
-		public:
-			using funcType = RT(Class::*)() const volatile;
-
-		private:
-			Class* _class;
-			funcType _funcPtr;
-
-#if SHARED_PTR_FUNCTIONS
-			Shared_Ptr<Class> _shared_class_ptr;
-#endif // SHARED_PTR_FUNCTIONS
-
-
 		public:
-			Func(Class* ClassPtr, funcType FuncPtr) : _class(ClassPtr), _funcPtr(FuncPtr)
+			template <typename C = Class, enable_if_t<is_same_v<C, void>, bool> = false>
+			Bound_Func(funcType FuncPtr) : _funcPtr(FuncPtr)
 			{
 			}
 
-#if SHARED_PTR_FUNCTIONS
-			Func(Shared_Ptr<Class>&& ClassPtr, funcType FuncPtr) : _class(ClassPtr.Get()), _funcPtr(FuncPtr), _shared_class_ptr(Move(ClassPtr))
+			template <typename C = Class, enable_if_t<!is_same_v<C, void>, bool> = false>
+			Bound_Func(targetType Target, funcType FuncPtr) : _target(ACBYTES::Move(Target)), _funcPtr(FuncPtr)
 			{
 			}
-#endif // SHARED_PTR_FUNCTIONS
 
-			RT operator()() volatile
+			/*
+			* Calls the function. A WEAK Func whose object is gone skips the call and returns RT(), so it needs RT to be void
+			* or default constructible; TryCall works for any RT.
+			*/
+			RT operator()(ArgT... Args) const noexcept(Has(PQ, Post_Qualifiers::NOEXCEPT) && Binding != Func_Binding::WEAK)
 			{
-				return (_class->*_funcPtr)();
+				if constexpr (!is_member)
+					return _funcPtr(Forward<ArgT>(Args)...);
+				else if constexpr (Binding == Func_Binding::RAW)
+					return Call(_target, Forward<ArgT>(Args)...);
+				else if constexpr (Binding == Func_Binding::STRONG)
+					return Call(_target.Get(), Forward<ArgT>(Args)...);
+				else
+				{
+					static_assert(is_same_v<RT, void> || is_default_constructible_v<RT>, "A WEAK Func returning a reference or a type without a default constructor is called with TryCall.");
+					auto target = _target.Lock(); //Keeps the object alive during the call.
+					if (!target.Valid())
+						return RT();
+					return Call(target.Get(), Forward<ArgT>(Args)...);
+				}
 			}
 
-			Func() = delete;
-		};
-
-#pragma endregion RT, CLASS, PQ
-
-		/*
-		A function wrapper that can deal with static, non-static, and member functions.
-		@param RT Return type of the function.
-		@param ArgT Arguments that should be passed to the function.
-		*/
-		template <typename RT, typename... ArgT>
-		class Func<RT, void, Post_Qualifiers::NONE, ArgT...>
-		{
-		public:
-			using funcType = RT(*)(ArgT...);
-
-		private:
-			funcType _funcPtr;
-
-		public:
-			Func(funcType FuncPtr) : _funcPtr(FuncPtr)
+			/*
+			* Calls the function unless its object is gone and passes the result to Receive, called without arguments if RT is void.
+			* Returns whether the call was made, always true unless WEAK.
+			* @param Receive [Callable taking RT].
+			*/
+			template <typename Receiver>
+			bool TryCall(Receiver&& Receive, ArgT... Args) const
 			{
+				if constexpr (Binding == Func_Binding::WEAK)
+				{
+					auto target = _target.Lock();
+					if (!target.Valid())
+						return false;
+					if constexpr (is_same_v<RT, void>)
+					{
+						Call(target.Get(), Forward<ArgT>(Args)...);
+						Receive();
+					}
+					else
+						Receive(Call(target.Get(), Forward<ArgT>(Args)...));
+				}
+				else if constexpr (is_same_v<RT, void>)
+				{
+					(*this)(Forward<ArgT>(Args)...);
+					Receive();
+				}
+				else
+					Receive((*this)(Forward<ArgT>(Args)...));
+				return true;
 			}
 
-			RT operator()(ArgT... Args)
+			/*
+			* Whether the object is gone, always false unless WEAK. O(1), without locking the object.
+			*/
+			bool Expired() const
 			{
-				return _funcPtr(Forward<ArgT>(Args)...);
+				if constexpr (Binding == Func_Binding::WEAK)
+					return _target.Expired();
+				else
+					return false;
 			}
 
-			Func() = delete;
+			Bound_Func() = delete;
 		};
 
 		/*
-		A function wrapper that can deal with static, non-static, and member functions.
-		@param RT Return type of the function.
+		* Func holding its object, if any, by raw pointer.
 		*/
-		template <typename RT>
-		class Func<RT, void>
-		{
-		public:
-			using funcType = RT(*)();
-
-		private:
-			funcType _funcPtr;
-
-		public:
-			Func(funcType FuncPtr) : _funcPtr(FuncPtr)
-			{
-			}
+		template <typename RT, typename Class, Post_Qualifiers PQ = Post_Qualifiers::NONE, typename... ArgT>
+		using Func = Bound_Func<RT, Class, PQ, Func_Binding::RAW, ArgT...>;
 
-			RT operator()()
-			{
-				return _funcPtr();
-			}
+	private:
+		template <typename Method, Func_Binding Binding = Func_Binding::RAW, typename Signature = typename member_function_traits<Method>::signature>
+		struct Method_Func;
 
-			Func() = delete;
+		template <typename Method, Func_Binding Binding, typename RT, typename... ArgT>
+		struct Method_Func<Method, Binding, RT(ArgT...)>
+		{
+			typedef member_function_traits<Method> traits;
+			typedef Bound_Func<RT, typename traits::classType, QualifiersOf<traits>(), Binding, ArgT...> type;
 		};
 
 	public:
@@ -411,21 +234,22 @@ namespace ACBYTES
 		* @param ArgT [Type of the Arguments Passed to the Function].
 		* @param FunctionPointer [Target Function]
 		*/
-		static auto WrapFunction(typename Function::Func<void, void>::funcType FunctionPointer)
+		template<typename RT, typename... ArgT, bool NoExcept>
+		static auto WrapFunction(RT(*FunctionPointer)(ArgT...) noexcept(NoExcept))
 		{
-			return Function::Func<void, void>(FunctionPointer);
+			constexpr auto qualifiers = NoExcept ? Post_Qualifiers::NOEXCEPT : Post_Qualifiers::NONE;
+			return Function::Func<RT, void, qualifiers, ArgT...>(FunctionPointer);
 		}
 
 		/*
-		* Wraps non-member function in a Func class.
-		* @param RT [Return Type of the Function].
-		* @param ArgT [Type of the Arguments Passed to the Function].
+		* Wraps member function in a Func class, deducing its return, class and argument types along with its qualifiers.
+		* @param ClassPointer [Pointer to instance of the function's class or a class deriving from it].
 		* @param FunctionPointer [Target Function]
 		*/
-		template<typename RT, typename... ArgT>
-		static auto WrapFunction(typename Function::Func<RT, void, Post_Qualifiers::NONE, ArgT...>::funcType FunctionPointer)
+		template<typename Class, typename Method>
+		static auto WrapFunction(Class* ClassPointer, Method FunctionPointer) -> typename Method_Func<Method>::type
 		{
-			return Function::Func<RT, void, Post_Qualifiers::NONE, ArgT...>(FunctionPointer);
+			return typename Method_Func<Method>::type(ClassPointer, FunctionPointer);
 		}
 
 		/*
@@ -437,7 +261,7 @@ namespace ACBYTES
 		* @param FunctionPointer [Target Function]
 		*/
 		template<typename RT, typename Class, typename... ArgT>
-		static auto WrapFunction(Class* ClassPointer, typename Function::Func<RT, Class, Post_Qualifiers::NONE, ArgT...>::funcType FunctionPointer)
+		static auto WrapFunction(Class* ClassPointer, RT(Class::*FunctionPointer)(ArgT...))
 		{
 			return Function::Func<RT, Class, Post_Qualifiers::NONE, ArgT...>(ClassPointer, FunctionPointer);
 		}
@@ -457,38 +281,53 @@ namespace ACBYTES
 			return Function::Func<RT, Class, PQ, ArgT...>(ClassPointer, FunctionPointer);
 		}
 
-#if SHARED_PTR_FUNCTIONS
-
 		/*
 		* Wraps member function in a Func class keeping a shared pointer copy, preventing the class instance from getting deleted.
-		* @param RT [Return Type of the Function].
-		* @param Class [Containing Class Type].
-		* @param ArgT [Type of the Arguments Passed to the Function].
-		* @param ClassPointer [Shared pointer to an instance of Class].
+		* Deduces the return, class and argument types along with the qualifiers.
+		* @param ClassPointer [Shared pointer to an instance of the function's class].
 		* @param FunctionPointer [Target Function]
 		*/
-		template<typename RT, typename Class, typename... ArgT>
-		static auto WrapFunction(Shared_Ptr<Class> ClassPointer, typename Function::Func<RT, Class, Post_Qualifiers::NONE, ArgT...>::funcType FunctionPointer)
+		template<typename Class, typename Method>
+		static auto WrapFunction(Shared_Ptr<Class> ClassPointer, Method FunctionPointer) -> typename Method_Func<Method, Func_Binding::STRONG>::type
 		{
-			return Function::Func<RT, Class, Post_Qualifiers::NONE, ArgT...>(Move(ClassPointer), FunctionPointer);
+			return typename Method_Func<Method, Func_Binding::STRONG>::type(Move(ClassPointer), FunctionPointer);
 		}
 
 		/*
-		* Wraps member function in a Func class keeping a shared pointer copy, preventing the class instance from getting deleted.
-		* @param RT [Return Type of the Function].
-		* @param Class [Containing Class Type].
-		* @param PQ [Target member function's post-qualifiers]
-		* @param ArgT [Type of the Arguments Passed to the Function].
-		* @param ClassPointer [Shared pointer to an instance of Class].
+		* Wraps member function in a Func class holding a weak pointer, which skips calls once the class instance is gone.
+		* Deduces the return, class and argument types along with the qualifiers.
+		* @param ClassPointer [Weak pointer to an instance of the function's class].
 		* @param FunctionPointer [Target Function]
 		*/
-		template<typename RT, typename Class, Post_Qualifiers PQ, typename... ArgT>
-		static auto WrapFunction(Shared_Ptr<Class> ClassPointer, typename Function::Func<RT, Class, PQ, ArgT...>::funcType FunctionPointer)
+		template<typename Class, typename Method>
+		static auto WrapFunction(Weak_Ptr<Class> ClassPointer, Method FunctionPointer) -> typename Method_Func<Method, Func_Binding::WEAK>::type
 		{
-			return Function::Func<RT, Class, PQ, ArgT...>(Move(ClassPointer), FunctionPointer);
+			return typename Method_Func<Method, Func_Binding::WEAK>::type(Move(ClassPointer), FunctionPointer);
+		}
+
+		/*
+		* Wraps member function in a Func class binding a shared instance as Binding says:
+		* auto onResize = Function::WrapFunction<Function::Func_Binding::WEAK>(window, &Window::OnResize);
+		* @param Binding [How the Func holds the instance].
+		* @param ClassPointer [Shared pointer to an instance of the function's class].
+		* @param FunctionPointer [Target Function]
+		*/
+		template<Func_Binding Binding, typename Class, typename Method>
+		static auto WrapFunction(const Shared_Ptr<Class>& ClassPointer, Method FunctionPointer) -> typename Method_Func<Method, Binding>::type
+		{
+			if constexpr (Binding == Func_Binding::RAW)
+				return typename Method_Func<Method, Binding>::type(ClassPointer.Get(), FunctionPointer);
+			else
+				return typename Method_Func<Method, Binding>::type(ClassPointer, FunctionPointer);
 		}
-#endif //SHARED_PTR_FUNCTIONS
 #pragma endregion Func
 	};
+
+	//A Func is a function pointer plus a raw, shared or weak object pointer.
+	template <typename RT, typename Class, Function::Post_Qualifiers PQ, Function::Func_Binding Binding, typename... ArgT>
+	struct is_trivially_relocatable<Function::Bound_Func<RT, Class, PQ, Binding, ArgT...>>
+	{
+		static constexpr bool value = true;
+	};
 } //namespace ACBYTES
 #endif FUNCTION_H
\ No newline at end of file
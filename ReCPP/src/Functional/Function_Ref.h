@@ -0,0 +1,96 @@
+#ifndef FUNCTION_REF_H
+#define FUNCTION_REF_H
+
+#pragma once
+
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Function_Ref
+	template <typename Signature>
+	class Function_Ref;
+
+	/*
+	* Non-owning reference to any callable (Function::Func instances, lambdas, functors and free functions).
+	* Holds an object/function pointer and a caller pointer, so it never allocates and is trivially copyable.
+	* The referenced callable must outlive the Function_Ref; meant for callback parameters that are only used for the duration of a call.
+	* @param RT [Return type of the callable].
+	* @param ArgT [Arguments that should be passed to the callable].
+	*/
+	template <typename RT, typename... ArgT>
+	class Function_Ref<RT(ArgT...)>
+	{
+	public:
+		using funcType = RT(*)(ArgT...);
+
+	private:
+		union Bound_Target
+		{
+			void* _object;
+			funcType _funcPtr;
+			void (*_otherFuncPtr)(); //A function pointer of another signature, cast back before calling.
+		};
+
+		using callerType = RT(*)(Bound_Target, ArgT...);
+
+		Bound_Target _target;
+		callerType _caller;
+
+		template <typename Callable>
+		static RT CallObject(Bound_Target Target, ArgT... Args)
+		{
+			return static_cast<RT>((*static_cast<Callable*>(Target._object))(Forward<ArgT>(Args)...));
+		}
+
+		template <typename Pointer>
+		static RT CallPointer(Bound_Target Target, ArgT... Args)
+		{
+			return static_cast<RT>(reinterpret_cast<Pointer>(Target._otherFuncPtr)(Forward<ArgT>(Args)...));
+		}
+
+		static RT CallFunction(Bound_Target Target, ArgT... Args)
+		{
+			return static_cast<RT>(Target._funcPtr(Forward<ArgT>(Args)...));
+		}
+
+		//Functions and function pointers are stored by value, other callables by address.
+		template <typename Callable>
+		static constexpr bool is_function_pointer = is_pointer_v<decay_t<Callable>> && is_function_v<remove_pointer_t<decay_t<Callable>>>;
+
+	public:
+		Function_Ref(funcType FunctionPointer) noexcept : _caller(&CallFunction)
+		{
+			_target._funcPtr = FunctionPointer;
+		}
+
+		/*
+		* @param Target [Callable invocable with ArgT whose result converts to RT].
+		*/
+		template <typename Callable, enable_if_t<!is_same_v<remove_cv_t<remove_reference_t<Callable>>, Function_Ref> && is_invocable_r_v<RT, remove_reference_t<Callable>&, ArgT...>, bool> = false>
+		Function_Ref(Callable&& Target) noexcept
+		{
+			if constexpr (is_function_pointer<Callable>)
+			{
+				using pointer = decay_t<Callable>;
+				_target._otherFuncPtr = reinterpret_cast<void (*)()>(static_cast<pointer>(Target));
+				_caller = &CallPointer<pointer>;
+			}
+			else
+			{
+				_target._object = (void*)&Target;
+				_caller = &CallObject<remove_reference_t<Callable>>;
+			}
+		}
+
+		RT operator()(ArgT... Args) const
+		{
+			return _caller(_target, Forward<ArgT>(Args)...);
+		}
+
+		Function_Ref() = delete;
+	};
+#pragma endregion Function_Ref
+}
+
+#endif FUNCTION_REF_H
\ No newline at end of file
@@ -0,0 +1,166 @@
+#ifndef JOB_H
+#define JOB_H
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Job
+	/*
+	* Move-only, type-erased void() callable. Callables up to inline_size bytes are stored inline; bigger ones fall back to the heap.
+	* Accepts Function::Func instances, Binder objects, lambdas, functors and free functions.
+	*/
+	class Job
+	{
+	public:
+		static constexpr size_t inline_size = 64 - sizeof(void*); //Keeps a Job within a single cache line on 64-bit targets.
+
+	private:
+		struct Operations
+		{
+			void(*invoke)(void*);
+			void(*move)(void* Destination, void* Source);
+			void(*destroy)(void*);
+		};
+
+		template <typename Callable>
+		struct Inline_Operations
+		{
+			static void Invoke(void* Storage)
+			{
+				(*static_cast<Callable*>(Storage))();
+			}
+
+			static void Move(void* Destination, void* Source)
+			{
+				new (Destination) Callable(ACBYTES::Move(*static_cast<Callable*>(Source)));
+				static_cast<Callable*>(Source)->~Callable();
+			}
+
+			static void Destroy(void* Storage)
+			{
+				static_cast<Callable*>(Storage)->~Callable();
+			}
+
+			static constexpr Operations operations{ &Invoke, &Move, &Destroy };
+		};
+
+		template <typename Callable>
+		struct Heap_Operations
+		{
+			static void Invoke(void* Storage)
+			{
+				(**static_cast<Callable**>(Storage))();
+			}
+
+			static void Move(void* Destination, void* Source)
+			{
+				*static_cast<Callable**>(Destination) = *static_cast<Callable**>(Source);
+			}
+
+			static void Destroy(void* Storage)
+			{
+				delete *static_cast<Callable**>(Storage);
+			}
+
+			static constexpr Operations operations{ &Invoke, &Move, &Destroy };
+		};
+
+		template <typename Callable>
+		static constexpr bool fits_inline = sizeof(Callable) <= inline_size && alignof(Callable) <= alignof(std::max_align_t);
+
+		alignas(std::max_align_t) unsigned char _storage[inline_size];
+		const Operations* _ops = nullptr;
+
+	public:
+		Job() noexcept //Empty job.
+		{
+		}
+
+		template <typename Callable, enable_if_t<!is_same_v<decay_t<Callable>, Job>, bool> = false>
+		Job(Callable&& Target)
+		{
+			Emplace(Forward<Callable>(Target));
+		}
+
+		Job(Job&& Rvr) noexcept
+		{
+			if (Rvr._ops)
+			{
+				Rvr._ops->move(_storage, Rvr._storage);
+				_ops = Rvr._ops;
+				Rvr._ops = nullptr;
+			}
+		}
+
+		Job& operator =(Job&& Rvr) noexcept
+		{
+			if (this != &Rvr)
+			{
+				Reset();
+				if (Rvr._ops)
+				{
+					Rvr._ops->move(_storage, Rvr._storage);
+					_ops = Rvr._ops;
+					Rvr._ops = nullptr;
+				}
+			}
+			return *this;
+		}
+
+		~Job()
+		{
+			Reset();
+		}
+
+		/*
+		* Replaces the stored callable.
+		* @param Target [Callable taking no arguments].
+		*/
+		template <typename Callable>
+		void Emplace(Callable&& Target)
+		{
+			using type = decay_t<Callable>;
+			Reset();
+			if constexpr (fits_inline<type>)
+			{
+				new (_storage) type(Forward<Callable>(Target));
+				_ops = &Inline_Operations<type>::operations;
+			}
+			else
+			{
+				*reinterpret_cast<type**>(_storage) = new type(Forward<Callable>(Target));
+				_ops = &Heap_Operations<type>::operations;
+			}
+		}
+
+		void Reset()
+		{
+			if (_ops)
+			{
+				_ops->destroy(_storage);
+				_ops = nullptr;
+			}
+		}
+
+		bool Valid() const
+		{
+			return _ops != nullptr;
+		}
+
+		void operator()()
+		{
+			_ops->invoke(_storage);
+		}
+
+		Job(const Job&) = delete;
+		Job& operator =(const Job&) = delete;
+	};
+#pragma endregion Job
+}
+
+#endif JOB_H
\ No newline at end of file
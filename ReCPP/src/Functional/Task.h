@@ -0,0 +1,488 @@
+#ifndef TASK_H
+#define TASK_H
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <new>
+#include <thread>
+#include "Type_Traits.h"
+#include "Thread_Pool.h"
+#include "Future.h"
+
+namespace ACBYTES
+{
+#pragma region Frame_Pool
+	/*
+	* Per-thread free lists for coroutine frames, bucketed by size. Frames bigger than the largest bucket use the global heap.
+	* Blocks are carved out of aligned chunks whose header names the owning pool. A frame freed on another thread (allocated by the
+	* submitting thread, completed on a worker) is pushed onto its owner's lock-free remote list, which the owner takes back when
+	* a bucket runs dry. When a thread exits its pool frees its chunks, or leaves that to the last remote free of its frames still alive.
+	*/
+	class Frame_Pool
+	{
+		static constexpr size_t granularity = 64;
+		static constexpr size_t bucket_count = 32; //Frames up to 2 KiB are pooled.
+		static constexpr size_t chunk_size = 16 * 1024;
+		static constexpr int64_t owner_alive = int64_t(1) << 62; //Keeps _remoteBalance above zero while the thread runs.
+
+		struct Free_Block
+		{
+			Free_Block* next;
+		};
+
+		struct Chunk
+		{
+			Frame_Pool* owner;
+			Chunk* next;
+		};
+
+		/*
+		* Owns the thread's pool; the pool outlives it while other threads still hold frames allocated from it.
+		*/
+		struct Pool_Holder
+		{
+			Frame_Pool* pool;
+
+			~Pool_Holder()
+			{
+				Current() = nullptr;
+				pool->Orphan();
+			}
+		};
+
+		Free_Block* _buckets[bucket_count] = {};
+		Chunk* _chunks = nullptr;
+		int64_t _allocated = 0; //Blocks handed out minus blocks freed by this thread.
+		alignas(granularity) std::atomic<Free_Block*> _remote[bucket_count] = {};
+		std::atomic<int64_t> _remoteBalance{ owner_alive }; //Minus the blocks other threads freed.
+
+		Frame_Pool() noexcept
+		{
+		}
+
+		~Frame_Pool()
+		{
+			while (_chunks)
+			{
+				auto next = _chunks->next;
+				::operator delete(_chunks, std::align_val_t(chunk_size));
+				_chunks = next;
+			}
+		}
+
+		//Trivially destructible, so frames freed after the holder's destructor still see that this thread has no pool anymore.
+		static Frame_Pool*& Current() noexcept
+		{
+			static thread_local Frame_Pool* current = nullptr;
+			return current;
+		}
+
+		static constexpr size_t BucketIndex(size_t Size) noexcept
+		{
+			return (Size + granularity - 1) / granularity - 1;
+		}
+
+		void Push(Free_Block* Block, size_t Index) noexcept
+		{
+			Block->next = _buckets[Index];
+			_buckets[Index] = Block;
+		}
+
+		void Refill(size_t Index)
+		{
+			auto remote = _remote[Index].exchange(nullptr, std::memory_order_acquire);
+			if (remote)
+			{
+				_buckets[Index] = remote;
+				return;
+			}
+
+			auto chunk = static_cast<Chunk*>(::operator new(chunk_size, std::align_val_t(chunk_size)));
+			chunk->owner = this;
+			chunk->next = _chunks;
+			_chunks = chunk;
+			auto blockSize = (Index + 1) * granularity;
+			auto blocks = reinterpret_cast<unsigned char*>(chunk) + granularity;
+			for (size_t i = 0; i < (chunk_size - granularity) / blockSize; i++)
+				Push(reinterpret_cast<Free_Block*>(blocks + i * blockSize), Index);
+		}
+
+		void RemoteFree(Free_Block* Block, size_t Index) noexcept
+		{
+			auto head = _remote[Index].load(std::memory_order_relaxed);
+			do
+				Block->next = head;
+			while (!_remote[Index].compare_exchange_weak(head, Block, std::memory_order_release, std::memory_order_relaxed));
+			if (_remoteBalance.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				delete this;
+		}
+
+		/*
+		* Called when the owning thread exits. Frees the pool now if none of its blocks are still allocated.
+		*/
+		void Orphan() noexcept
+		{
+			if (_remoteBalance.fetch_add(_allocated - owner_alive, std::memory_order_acq_rel) + _allocated - owner_alive == 0)
+				delete this;
+		}
+
+	public:
+		static Frame_Pool& Local()
+		{
+			static thread_local Pool_Holder holder{ Current() = new Frame_Pool() };
+			return *holder.pool;
+		}
+
+		void* Allocate(size_t Size)
+		{
+			auto index = BucketIndex(Size);
+			if (index >= bucket_count)
+				return ::operator new(Size);
+			if (!_buckets[index])
+				Refill(index);
+			auto block = _buckets[index];
+			_buckets[index] = block->next;
+			_allocated++;
+			return block;
+		}
+
+		/*
+		* Returns Ptr to the pool that allocated it, on whichever thread this runs.
+		*/
+		static void Deallocate(void* Ptr, size_t Size) noexcept
+		{
+			auto index = BucketIndex(Size);
+			if (index >= bucket_count)
+			{
+				::operator delete(Ptr);
+				return;
+			}
+			auto block = static_cast<Free_Block*>(Ptr);
+			auto owner = reinterpret_cast<Chunk*>(reinterpret_cast<uintptr_t>(Ptr) & ~uintptr_t(chunk_size - 1))->owner;
+			if (owner == Current())
+			{
+				owner->Push(block, index);
+				owner->_allocated--;
+			}
+			else
+				owner->RemoteFree(block, index);
+		}
+
+		Frame_Pool(const Frame_Pool&) = delete;
+		Frame_Pool& operator =(const Frame_Pool&) = delete;
+	};
+#pragma endregion Frame_Pool
+
+#pragma region Task_Promise
+	template <typename T>
+	class Task;
+
+	template <typename T>
+	struct Task_Promise_Base
+	{
+		std::coroutine_handle<> continuation;
+		std::atomic<bool> done{ false }; //Only set when nothing awaits the task, for Task::Get.
+
+		struct Final_Awaiter
+		{
+			bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			//Symmetric transfer to the awaiting coroutine, long await chains don't grow the stack.
+			template <typename Promise>
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> Handle) noexcept
+			{
+				auto next = Handle.promise().continuation;
+				if (next)
+					return next;
+				Handle.promise().done.store(true, std::memory_order_release);
+				return std::noop_coroutine();
+			}
+
+			void await_resume() const noexcept
+			{
+			}
+		};
+
+		static void* operator new(size_t Size)
+		{
+			return Frame_Pool::Local().Allocate(Size);
+		}
+
+		static void operator delete(void* Ptr, size_t Size) noexcept
+		{
+			Frame_Pool::Deallocate(Ptr, Size);
+		}
+
+		std::suspend_always initial_suspend() const noexcept
+		{
+			return {};
+		}
+
+		Final_Awaiter final_suspend() const noexcept
+		{
+			return {};
+		}
+
+		void unhandled_exception() const noexcept
+		{
+			std::terminate();
+		}
+	};
+
+	template <typename T>
+	struct Task_Promise : public Task_Promise_Base<T>
+	{
+	private:
+		Future_Value<T> _value;
+		bool _hasValue = false;
+
+	public:
+		~Task_Promise()
+		{
+			if (_hasValue)
+				_value.Destroy();
+		}
+
+		Task<T> get_return_object() noexcept;
+
+		template <typename T1>
+		void return_value(T1&& Value)
+		{
+			_value.Emplace(Forward<T1>(Value));
+			_hasValue = true;
+		}
+
+		T& Value()
+		{
+			return _value.Get();
+		}
+	};
+
+	template <>
+	struct Task_Promise<void> : public Task_Promise_Base<void>
+	{
+		Task<void> get_return_object() noexcept;
+
+		void return_void() const noexcept
+		{
+		}
+
+		void Value() const noexcept
+		{
+		}
+	};
+#pragma endregion Task_Promise
+
+#pragma region Task
+	/*
+	* Lazily started coroutine producing a T. Starts when awaited (or on Get) and resumes its awaiter through symmetric transfer.
+	* Frames come from the per-thread Frame_Pool.
+	* @param T [Type passed to co_return, void for none].
+	*/
+	template <typename T>
+	class Task
+	{
+	public:
+		using promise_type = Task_Promise<T>;
+		using handleType = std::coroutine_handle<promise_type>;
+
+	private:
+		handleType _handle;
+
+		struct Awaiter
+		{
+			handleType handle;
+
+			bool await_ready() const noexcept
+			{
+				return handle.done();
+			}
+
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<> Awaiting) noexcept
+			{
+				handle.promise().continuation = Awaiting;
+				return handle;
+			}
+
+			decltype(auto) await_resume()
+			{
+				if constexpr (!is_same_v<T, void>)
+					return Move(handle.promise().Value());
+			}
+		};
+
+		void Start()
+		{
+			if (!_handle.done() && !_handle.promise().continuation)
+				_handle.resume();
+		}
+
+	public:
+		[[nodiscard]] Task() noexcept //Empty task.
+		{
+		}
+
+		[[nodiscard]] explicit Task(handleType Handle) noexcept : _handle(Handle)
+		{
+		}
+
+		[[nodiscard]] Task(Task&& Rvr) noexcept : _handle(Rvr._handle)
+		{
+			Rvr._handle = nullptr;
+		}
+
+		Task& operator =(Task&& Rvr) noexcept
+		{
+			auto handle = _handle;
+			_handle = Rvr._handle;
+			Rvr._handle = handle;
+			return *this;
+		}
+
+		~Task()
+		{
+			if (_handle)
+				_handle.destroy();
+		}
+
+		bool Valid() const noexcept
+		{
+			return static_cast<bool>(_handle);
+		}
+
+		bool Done() const noexcept
+		{
+			return _handle.done();
+		}
+
+		Awaiter operator co_await() && noexcept
+		{
+			return Awaiter{ _handle };
+		}
+
+		Awaiter operator co_await() & noexcept
+		{
+			return Awaiter{ _handle };
+		}
+
+		/*
+		* Runs the task from non-coroutine code and waits for its result. The task may hop onto pools, the caller spins then yields meanwhile.
+		*/
+		decltype(auto) Get()
+		{
+			Start();
+			for (uint32_t i = 0; !_handle.promise().done.load(std::memory_order_acquire); i++)
+			{
+				if (i > 64)
+					std::this_thread::yield();
+			}
+			if constexpr (!is_same_v<T, void>)
+				return Move(_handle.promise().Value());
+		}
+
+		/*
+		* Like Get, executing the pool's pending jobs while waiting.
+		*/
+		decltype(auto) Get(Thread_Pool& Pool)
+		{
+			Start();
+			while (!_handle.promise().done.load(std::memory_order_acquire))
+			{
+				if (!Pool.TryRunOne())
+					std::this_thread::yield();
+			}
+			if constexpr (!is_same_v<T, void>)
+				return Move(_handle.promise().Value());
+		}
+
+		Task(const Task&) = delete;
+		Task& operator =(const Task&) = delete;
+	};
+
+	template <typename T>
+	Task<T> Task_Promise<T>::get_return_object() noexcept
+	{
+		return Task<T>(Task<T>::handleType::from_promise(*this));
+	}
+
+	inline Task<void> Task_Promise<void>::get_return_object() noexcept
+	{
+		return Task<void>(Task<void>::handleType::from_promise(*this));
+	}
+#pragma endregion Task
+
+#pragma region Awaiters
+	/*
+	* co_await Schedule_On(Pool) resumes the coroutine as a job on Pool.
+	*/
+	struct Pool_Awaiter
+	{
+		Thread_Pool& pool;
+
+		bool await_ready() const noexcept
+		{
+			return false;
+		}
+
+		void await_suspend(std::coroutine_handle<> Handle)
+		{
+			pool.Submit([Handle]() { Handle.resume(); });
+		}
+
+		void await_resume() const noexcept
+		{
+		}
+	};
+
+	[[nodiscard]] inline Pool_Awaiter Schedule_On(Thread_Pool& Pool) noexcept
+	{
+		return Pool_Awaiter{ Pool };
+	}
+
+	/*
+	* co_await on a Future resumes the coroutine on the thread that sets the value. A coroutine awaiting an abandoned future never resumes.
+	*/
+	template <typename T>
+	struct Future_Awaiter
+	{
+		Future<T>& future;
+
+		bool await_ready() const noexcept
+		{
+			return future.Ready();
+		}
+
+		void await_suspend(std::coroutine_handle<> Handle)
+		{
+			future._state.Get()->SetContinuation([Handle]() { Handle.resume(); });
+		}
+
+		decltype(auto) await_resume()
+		{
+			return future.Get();
+		}
+	};
+
+	template <typename T>
+	[[nodiscard]] Future_Awaiter<T> operator co_await(Future<T>& Target) noexcept
+	{
+		return Future_Awaiter<T>{ Target };
+	}
+
+	template <typename T>
+	[[nodiscard]] Future_Awaiter<T> operator co_await(Future<T>&& Target) noexcept
+	{
+		return Future_Awaiter<T>{ Target };
+	}
+#pragma endregion Awaiters
+}
+
+#endif TASK_H
\ No newline at end of file
@@ -1,4 +1,43 @@
 /*
 * Deletes all of the target class'/struct's default constructors.
 */
-#define NO_DEFAULT_CONSTRUCTORS(TypeName) TypeName() = delete; TypeName(const TypeName&) = delete; TypeName(TypeName&&) = delete
\ No newline at end of file
+#define NO_DEFAULT_CONSTRUCTORS(TypeName) TypeName() = delete; TypeName(const TypeName&) = delete; TypeName(TypeName&&) = delete
+
+/*
+* Lets empty members (e.g. stateless deleters) take no space. MSVC ignores the standard attribute and needs its own spelling.
+*/
+#if defined(_MSC_VER) && !defined(__clang__)
+#define NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+/*
+* Debug-only checks (assert based), on unless NDEBUG is defined.
+*/
+#ifndef NDEBUG
+#define ACBYTES_DEBUG 1
+#endif
+
+/*
+* x86 builds with SSE2 as their baseline get SSE2/AVX2 kernels. GCC and Clang only compile AVX2 intrinsics inside functions
+* marked with TARGET_AVX2, which lets those kernels live next to the baseline ones and be picked at runtime.
+*/
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || (defined(__i386__) && defined(__SSE2__))
+#define ACBYTES_SSE2 1
+#endif
+
+/*
+* Whether the compiler provides a builtin, 0 where __has_builtin itself is missing (MSVC).
+*/
+#ifdef __has_builtin
+#define ACBYTES_HAS_BUILTIN(Builtin) __has_builtin(Builtin)
+#else
+#define ACBYTES_HAS_BUILTIN(Builtin) 0
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
\ No newline at end of file
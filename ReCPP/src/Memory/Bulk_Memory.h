@@ -0,0 +1,349 @@
+#ifndef BULK_MEMORY_H
+#define BULK_MEMORY_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "Definitions.h"
+#include "Type_Traits.h"
+
+#ifdef ACBYTES_SSE2
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+namespace ACBYTES
+{
+#pragma region Cpu_Features
+	struct Cpu_Features
+	{
+		bool sse2;
+		bool avx2;
+	};
+
+	/*
+	* Detected once. AVX2 also requires the OS to save the upper halves of the registers.
+	*/
+	inline const Cpu_Features& Detect_Cpu_Features() noexcept
+	{
+		static const Cpu_Features features = []() noexcept
+		{
+			Cpu_Features detected{ false, false };
+#ifdef ACBYTES_SSE2
+			detected.sse2 = true;
+#if defined(_MSC_VER) && !defined(__clang__)
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] >= 7)
+			{
+				__cpuid(info, 1);
+				bool osSaves = (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6;
+				__cpuidex(info, 7, 0);
+				detected.avx2 = osSaves && (info[1] & (1 << 5));
+			}
+#else
+			detected.avx2 = __builtin_cpu_supports("avx2");
+#endif
+#endif
+			return detected;
+		}();
+		return features;
+	}
+#pragma endregion Cpu_Features
+
+#pragma region Bulk_Kernels
+	/*
+	* Byte level kernels picked at runtime. Copies past streaming_threshold use non-temporal stores so they don't evict the whole cache,
+	* smaller ones go to memcpy, which is already as fast as it gets for data that stays cached.
+	*/
+	namespace Bulk_Kernels
+	{
+		static constexpr size_t streaming_threshold = 8 * 1024 * 1024;
+		static constexpr size_t pattern_size = 32;
+
+		struct Kernel_Table
+		{
+			void(*copy)(unsigned char* Destination, const unsigned char* Source, size_t Bytes);
+			void(*fill)(unsigned char* Destination, size_t Bytes, const unsigned char* Pattern); //Pattern is pattern_size bytes, Destination gets it repeated.
+			bool(*equal)(const unsigned char* Left, const unsigned char* Right, size_t Bytes);
+		};
+
+		inline void Copy_Scalar(unsigned char* Destination, const unsigned char* Source, size_t Bytes)
+		{
+			memcpy(Destination, Source, Bytes);
+		}
+
+		inline void Fill_Scalar(unsigned char* Destination, size_t Bytes, const unsigned char* Pattern)
+		{
+			for (; Bytes >= pattern_size; Bytes -= pattern_size, Destination += pattern_size)
+				memcpy(Destination, Pattern, pattern_size);
+			memcpy(Destination, Pattern, Bytes);
+		}
+
+		inline bool Equal_Scalar(const unsigned char* Left, const unsigned char* Right, size_t Bytes)
+		{
+			return memcmp(Left, Right, Bytes) == 0;
+		}
+
+#ifdef ACBYTES_SSE2
+		inline void Copy_Sse2(unsigned char* Destination, const unsigned char* Source, size_t Bytes)
+		{
+			if (Bytes < streaming_threshold)
+			{
+				memcpy(Destination, Source, Bytes);
+				return;
+			}
+			auto head = (16 - (reinterpret_cast<uintptr_t>(Destination) & 15)) & 15;
+			memcpy(Destination, Source, head);
+			Destination += head;
+			Source += head;
+			Bytes -= head;
+			for (; Bytes >= 64; Bytes -= 64, Destination += 64, Source += 64)
+			{
+				auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source));
+				auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + 16));
+				auto c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + 32));
+				auto d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + 48));
+				_mm_stream_si128(reinterpret_cast<__m128i*>(Destination), a);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(Destination + 16), b);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(Destination + 32), c);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(Destination + 48), d);
+			}
+			_mm_sfence();
+			memcpy(Destination, Source, Bytes);
+		}
+
+		inline void Fill_Sse2(unsigned char* Destination, size_t Bytes, const unsigned char* Pattern)
+		{
+			auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Pattern));
+			auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Pattern + 16));
+			for (; Bytes >= pattern_size; Bytes -= pattern_size, Destination += pattern_size)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination), low);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Destination + 16), high);
+			}
+			memcpy(Destination, Pattern, Bytes);
+		}
+
+		inline bool Equal_Sse2(const unsigned char* Left, const unsigned char* Right, size_t Bytes)
+		{
+			for (; Bytes >= 16; Bytes -= 16, Left += 16, Right += 16)
+			{
+				auto equal = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Left)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(Right)));
+				if (_mm_movemask_epi8(equal) != 0xFFFF)
+					return false;
+			}
+			return memcmp(Left, Right, Bytes) == 0;
+		}
+
+		TARGET_AVX2 inline void Copy_Avx2(unsigned char* Destination, const unsigned char* Source, size_t Bytes)
+		{
+			if (Bytes < streaming_threshold)
+			{
+				memcpy(Destination, Source, Bytes);
+				return;
+			}
+			auto head = (32 - (reinterpret_cast<uintptr_t>(Destination) & 31)) & 31;
+			memcpy(Destination, Source, head);
+			Destination += head;
+			Source += head;
+			Bytes -= head;
+			for (; Bytes >= 128; Bytes -= 128, Destination += 128, Source += 128)
+			{
+				auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Source));
+				auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Source + 32));
+				auto c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Source + 64));
+				auto d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Source + 96));
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(Destination), a);
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(Destination + 32), b);
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(Destination + 64), c);
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(Destination + 96), d);
+			}
+			_mm_sfence();
+			memcpy(Destination, Source, Bytes);
+		}
+
+		TARGET_AVX2 inline void Fill_Avx2(unsigned char* Destination, size_t Bytes, const unsigned char* Pattern)
+		{
+			auto pattern = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Pattern));
+			for (; Bytes >= 4 * pattern_size; Bytes -= 4 * pattern_size, Destination += 4 * pattern_size)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination), pattern);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination + 32), pattern);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination + 64), pattern);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination + 96), pattern);
+			}
+			for (; Bytes >= pattern_size; Bytes -= pattern_size, Destination += pattern_size)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Destination), pattern);
+			memcpy(Destination, Pattern, Bytes);
+		}
+
+		TARGET_AVX2 inline bool Equal_Avx2(const unsigned char* Left, const unsigned char* Right, size_t Bytes)
+		{
+			for (; Bytes >= 64; Bytes -= 64, Left += 64, Right += 64)
+			{
+				auto a = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Left)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Right)));
+				auto b = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Left + 32)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Right + 32)));
+				if (_mm256_movemask_epi8(_mm256_and_si256(a, b)) != -1)
+					return false;
+			}
+			for (; Bytes >= 32; Bytes -= 32, Left += 32, Right += 32)
+			{
+				auto equal = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(Left)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Right)));
+				if (_mm256_movemask_epi8(equal) != -1)
+					return false;
+			}
+			return memcmp(Left, Right, Bytes) == 0;
+		}
+#endif
+
+		inline const Kernel_Table& Kernels() noexcept
+		{
+			static const Kernel_Table table = []() noexcept
+			{
+#ifdef ACBYTES_SSE2
+				auto& features = Detect_Cpu_Features();
+				if (features.avx2)
+					return Kernel_Table{ &Copy_Avx2, &Fill_Avx2, &Equal_Avx2 };
+				if (features.sse2)
+					return Kernel_Table{ &Copy_Sse2, &Fill_Sse2, &Equal_Sse2 };
+#endif
+				return Kernel_Table{ &Copy_Scalar, &Fill_Scalar, &Equal_Scalar };
+			}();
+			return table;
+		}
+	}
+#pragma endregion Bulk_Kernels
+
+#pragma region Bulk_Operations
+	/*
+	* Copies Count elements. Trivially copyable types go through the byte kernels, others are assigned one by one. The ranges must not overlap.
+	*/
+	template <typename T>
+	void Bulk_Copy(T* Destination, const T* Source, size_t Count)
+	{
+		if constexpr (is_trivially_copyable_v<T>)
+			Bulk_Kernels::Kernels().copy(reinterpret_cast<unsigned char*>(Destination), reinterpret_cast<const unsigned char*>(Source), Count * sizeof(T));
+		else
+		{
+			for (size_t i = 0; i < Count; i++)
+				Destination[i] = Source[i];
+		}
+	}
+
+	/*
+	* Assigns Value to Count elements. Trivially copyable types whose size divides 32 bytes are stored as a repeated byte pattern.
+	*/
+	template <typename T>
+	void Bulk_Fill(T* Destination, size_t Count, const T& Value)
+	{
+		if constexpr (is_trivially_copyable_v<T> && sizeof(T) == 1)
+			memset(static_cast<void*>(Destination), *reinterpret_cast<const unsigned char*>(&Value), Count);
+		else if constexpr (is_trivially_copyable_v<T> && Bulk_Kernels::pattern_size % sizeof(T) == 0)
+		{
+			alignas(32) unsigned char pattern[Bulk_Kernels::pattern_size];
+			for (size_t i = 0; i < Bulk_Kernels::pattern_size; i += sizeof(T))
+				memcpy(pattern + i, &Value, sizeof(T));
+			Bulk_Kernels::Kernels().fill(reinterpret_cast<unsigned char*>(Destination), Count * sizeof(T), pattern);
+		}
+		else
+		{
+			for (size_t i = 0; i < Count; i++)
+				Destination[i] = Value;
+		}
+	}
+
+	/*
+	* Compares Count elements. Integers, enums and pointers are compared bytewise, everything else with its operator ==,
+	* since a class may define equality that differs from its bytes even when it has no padding.
+	*/
+	template <typename T>
+	[[nodiscard]] bool Bulk_Equal(const T* Left, const T* Right, size_t Count)
+	{
+		if constexpr (is_integral_v<T> || is_enum_v<T> || is_pointer_v<remove_cv_t<T>>)
+			return Bulk_Kernels::Kernels().equal(reinterpret_cast<const unsigned char*>(Left), reinterpret_cast<const unsigned char*>(Right), Count * sizeof(T));
+		else
+		{
+			for (size_t i = 0; i < Count; i++)
+			{
+				if (!(Left[i] == Right[i]))
+					return false;
+			}
+			return true;
+		}
+	}
+#pragma endregion Bulk_Operations
+
+#pragma region Array_Operations
+	/*
+	* Copies the elements of an array pointer (Unique_Ptr<T[]>, Shared_Ptr<T[]>, Weak_Ptr<T[]>) starting at Offset into Destination.
+	* Returns how many were copied: at most Count, fewer when the array ends first.
+	*/
+	template <typename Array>
+	size_t Copy_To(const Array& Source, array_element_t<const Array>* Destination, size_t Count, size_t Offset = 0)
+	{
+		auto size = Source.Size();
+		if (Offset >= size)
+			return 0;
+		auto count = size - Offset < Count ? size - Offset : Count;
+		Bulk_Copy(Destination, Source.Get() + Offset, count);
+		return count;
+	}
+
+	template <typename Array, size_t N>
+	size_t Copy_To(const Array& Source, array_element_t<const Array>(&Destination)[N])
+	{
+		return Copy_To(Source, Destination, N);
+	}
+
+	/*
+	* Copies Count elements of Source into the array pointer starting at Offset. Returns how many fit.
+	*/
+	template <typename Array>
+	size_t Copy_From(Array& Target, const array_element_t<Array>* Source, size_t Count, size_t Offset = 0)
+	{
+		auto size = Target.Size();
+		if (Offset >= size)
+			return 0;
+		auto count = size - Offset < Count ? size - Offset : Count;
+		Bulk_Copy(Target.Get() + Offset, Source, count);
+		return count;
+	}
+
+	template <typename Array, size_t N>
+	size_t Copy_From(Array& Target, const array_element_t<Array>(&Source)[N])
+	{
+		return Copy_From(Target, Source, N);
+	}
+
+	template <typename Array>
+	void Fill_Value(Array& Target, const array_element_t<Array>& Value)
+	{
+		Bulk_Fill(Target.Get(), Target.Size(), Value);
+	}
+
+	/*
+	* Whether both array pointers have the same size and equal elements, compared as in Bulk_Equal.
+	*/
+	template <typename Array, typename Array1>
+	[[nodiscard]] bool Equal(const Array& Left, const Array1& Right)
+	{
+		return Left.Size() == Right.Size() && (Left.Get() == Right.Get() || Bulk_Equal(Left.Get(), Right.Get(), Left.Size()));
+	}
+
+	/*
+	* Whether the array pointer holds exactly the Count elements of Right.
+	*/
+	template <typename Array>
+	[[nodiscard]] bool Equal(const Array& Left, const array_element_t<const Array>* Right, size_t Count)
+	{
+		return Left.Size() == Count && Bulk_Equal(static_cast<const array_element_t<const Array>*>(Left.Get()), Right, Count);
+	}
+#pragma endregion Array_Operations
+}
+
+#endif BULK_MEMORY_H
\ No newline at end of file
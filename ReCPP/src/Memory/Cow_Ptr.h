@@ -0,0 +1,144 @@
+#ifndef COW_PTR_H
+#define COW_PTR_H
+
+#pragma once
+
+#include "Smart_Pointers.h"
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Cow_Ptr
+	/*
+	* Copy-on-write pointer. Copies share the object until one of them asks for mutable access, which copies the object
+	* only while it is shared. Const access never copies.
+	* Concurrent readers are fine; a Cow_Ptr itself, like any Shared_Ptr, must not be written and copied from different threads at once.
+	* @param T [Pointed-to type, must be copy constructible].
+	*/
+	template <typename T>
+	class Cow_Ptr
+	{
+		Shared_Ptr<T> _ptr;
+
+	public:
+		[[nodiscard]] Cow_Ptr(std::nullptr_t = nullptr) //Empty pointer.
+		{
+		}
+
+		[[nodiscard]] explicit Cow_Ptr(const Shared_Ptr<T>& Ref) : _ptr(Ref)
+		{
+		}
+
+		[[nodiscard]] explicit Cow_Ptr(Shared_Ptr<T>&& Rvr) noexcept : _ptr(Move(Rvr))
+		{
+		}
+
+		[[nodiscard]] Cow_Ptr(const Cow_Ptr& Ref) : _ptr(Ref._ptr)
+		{
+		}
+
+		[[nodiscard]] Cow_Ptr(Cow_Ptr&& Rvr) noexcept : _ptr(Move(Rvr._ptr))
+		{
+		}
+
+		Cow_Ptr& operator =(const Cow_Ptr& Ref)
+		{
+			_ptr = Ref._ptr;
+			return *this;
+		}
+
+		Cow_Ptr& operator =(Cow_Ptr&& Rvr) noexcept
+		{
+			_ptr = Move(Rvr._ptr);
+			return *this;
+		}
+
+		void Swap(Cow_Ptr& Ref)
+		{
+			_ptr.Swap(Ref._ptr);
+		}
+
+		void Reset()
+		{
+			_ptr.Reset();
+		}
+
+		/*
+		* Gives this pointer a private copy of the object if it is shared, so it can be mutated. Returns whether a copy was made.
+		*/
+		bool Detach()
+		{
+			if (_ptr.Valid() && !_ptr.Unique())
+			{
+				_ptr = Make_Shared<T>(*static_cast<const T*>(_ptr.Get()));
+				return true;
+			}
+			return false;
+		}
+
+		/*
+		* Mutable access, detaching first if the object is shared. Pointers obtained earlier from other copies keep seeing the old object.
+		*/
+		T* GetMutable()
+		{
+			Detach();
+			return _ptr.Get();
+		}
+
+		bool Valid() const noexcept
+		{
+			return _ptr.Get() != nullptr;
+		}
+
+		bool Unique() const noexcept
+		{
+			return _ptr.Unique();
+		}
+
+		uint32_t UseCount() const noexcept
+		{
+			return _ptr.UseCount();
+		}
+
+		/*
+		* The shared object, for publishing to code that takes Shared_Ptr. Mutating through it bypasses copy-on-write.
+		*/
+		const Shared_Ptr<T>& GetShared() const noexcept
+		{
+			return _ptr;
+		}
+
+		const T* Get() const noexcept
+		{
+			return _ptr.Get();
+		}
+
+		const T* operator ->() const noexcept
+		{
+			return _ptr.Get();
+		}
+
+		const T& operator *() const noexcept
+		{
+			return *_ptr.Get();
+		}
+	};
+
+	/*
+	* Makes copy-on-write pointer pointing to an object of type T.
+	*/
+	template <typename T, typename... ArgT>
+	[[nodiscard]] auto Make_Cow(ArgT&&... Arguments) -> Cow_Ptr<T>
+	{
+		return Cow_Ptr<T>(Make_Shared<T>(Forward<ArgT>(Arguments)...));
+	}
+
+	template <typename T>
+	struct is_trivially_relocatable<Cow_Ptr<T>>
+	{
+		static constexpr bool value = true;
+	};
+#pragma endregion Cow_Ptr
+}
+
+#endif COW_PTR_H
\ No newline at end of file
@@ -1,10 +1,10 @@
-//TODO
-
 #ifndef DELETER_H
 #define DELETER_H
 
 #pragma once
 
+#include "Type_Traits.h"
+
 namespace ACBYTES
 {
 	template <typename T>
@@ -15,7 +15,7 @@ namespace ACBYTES
 			static_assert(sizeof(T) > 0, "Unable to construct with incomplete type.");
 		}
 
-		template <typename T1, enable_if_t<is_convertible_v<T1, T> && (sizeof(T1) > 0), bool> = false>
+		template <typename T1, enable_if_t<is_convertible_v<T1*, T*> && (sizeof(T1) > 0), bool> = false>
 		constexpr Default_Delete(const Default_Delete<T1>&) noexcept
 		{
 		}
@@ -41,7 +41,7 @@ namespace ACBYTES
 
 		void operator()(T* Ptr) const
 		{
-			delete Ptr;
+			delete[] Ptr;
 		}
 	};
 }
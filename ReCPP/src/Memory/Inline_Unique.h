@@ -0,0 +1,245 @@
+#ifndef INLINE_UNIQUE_H
+#define INLINE_UNIQUE_H
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include "Smart_Pointers.h"
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Inline_Unique
+	template <typename T, typename = void>
+	struct is_move_constructible_helper
+	{
+		static constexpr bool value = false;
+	};
+
+	template <typename T>
+	struct is_move_constructible_helper<T, decltype(::new (Declval<void*>()) T(Declval<T&&>()), void())>
+	{
+		static constexpr bool value = true;
+	};
+
+	/*
+	* Type-erased lifetime operations of the most derived type, shared by every Inline_Unique holding it regardless of the base type.
+	*/
+	struct Inline_Operations
+	{
+		size_t size;
+		size_t alignment;
+		bool movable;
+		void(*destroy)(void* Object);
+		void(*destroyHeap)(void* Object);
+		void*(*moveTo)(void* Storage, void* Object); //Move constructs into Storage (or onto the heap when null), then destroys Object.
+
+		template <typename T>
+		static const Inline_Operations* For() noexcept
+		{
+			static constexpr Inline_Operations operations{ sizeof(T), alignof(T), is_move_constructible_helper<T>::value, &Destroy<T>, &DestroyHeap<T>, &MoveTo<T> };
+			return &operations;
+		}
+
+	private:
+		template <typename T>
+		static void Destroy(void* Object)
+		{
+			static_cast<T*>(Object)->~T();
+		}
+
+		template <typename T>
+		static void DestroyHeap(void* Object)
+		{
+			delete static_cast<T*>(Object);
+		}
+
+		template <typename T>
+		static void* MoveTo(void* Storage, void* Object)
+		{
+			if constexpr (is_move_constructible_helper<T>::value)
+			{
+				auto source = static_cast<T*>(Object);
+				T* target = Storage ? new (Storage) T(Move(*source)) : new T(Move(*source));
+				source->~T();
+				return target;
+			}
+			else
+				return nullptr; //Never called, immovable types are kept on the heap.
+		}
+	};
+
+	/*
+	* Owning polymorphic pointer that stores objects of up to Capacity bytes inline and falls back to the heap for bigger,
+	* over-aligned or immovable ones. Converts from Inline_Unique/Unique_Ptr of derived types like Unique_Ptr does.
+	* @param Base [Pointed-to type, the stored object may be of any type deriving from it].
+	* @param Capacity [Inline storage size in bytes].
+	*/
+	template <typename Base, size_t Capacity = 64>
+	class Inline_Unique
+	{
+		template <typename, size_t> friend class Inline_Unique;
+
+		alignas(std::max_align_t) unsigned char _storage[Capacity];
+		Base* _ptr = nullptr;
+		void* _object = nullptr; //Most derived object, what the operations work on.
+		const Inline_Operations* _ops = nullptr;
+
+		template <typename T>
+		static constexpr bool fits_inline = sizeof(T) <= Capacity && alignof(T) <= alignof(std::max_align_t) && is_move_constructible_helper<T>::value;
+
+		bool FitsInline(const Inline_Operations* Ops) const noexcept
+		{
+			return Ops->movable && Ops->size <= Capacity && Ops->alignment <= alignof(std::max_align_t);
+		}
+
+		/*
+		* Takes Source's object, relocating it into this storage (or onto the heap) when Source keeps it inline.
+		*/
+		template <typename Base1, size_t Capacity1>
+		void Take(Inline_Unique<Base1, Capacity1>& Source)
+		{
+			if (!Source._ptr)
+				return;
+
+			Base* base = Source._ptr;
+			if (Source.IsInline())
+			{
+				auto offset = reinterpret_cast<unsigned char*>(base) - static_cast<unsigned char*>(Source._object);
+				_object = Source._ops->moveTo(FitsInline(Source._ops) ? _storage : nullptr, Source._object);
+				_ptr = reinterpret_cast<Base*>(static_cast<unsigned char*>(_object) + offset);
+			}
+			else
+			{
+				_object = Source._object;
+				_ptr = base;
+			}
+			_ops = Source._ops;
+			Source._ptr = nullptr;
+			Source._object = nullptr;
+			Source._ops = nullptr;
+		}
+
+	public:
+		[[nodiscard]] Inline_Unique(std::nullptr_t = nullptr) noexcept //Empty pointer.
+		{
+		}
+
+		[[nodiscard]] Inline_Unique(Inline_Unique&& Rvr) noexcept
+		{
+			Take(Rvr);
+		}
+
+		template <typename Base1, size_t Capacity1, enable_if_t<is_convertible_v<Base1*, Base*>, bool> = false>
+		[[nodiscard]] Inline_Unique(Inline_Unique<Base1, Capacity1>&& Rvr) noexcept
+		{
+			Take(Rvr);
+		}
+
+		/*
+		* Adopts a heap object owned by a Unique_Ptr; it stays on the heap.
+		*/
+		template <typename T, enable_if_t<is_convertible_v<T*, Base*>, bool> = false>
+		[[nodiscard]] Inline_Unique(Unique_Ptr<T>&& Rvr) noexcept
+		{
+			if (Rvr.Valid())
+			{
+				_object = Rvr.Get();
+				_ptr = Rvr.Get();
+				_ops = Inline_Operations::For<T>();
+				Rvr.Release();
+			}
+		}
+
+		Inline_Unique& operator =(Inline_Unique&& Rvr) noexcept
+		{
+			if (this != &Rvr)
+			{
+				Reset();
+				Take(Rvr);
+			}
+			return *this;
+		}
+
+		~Inline_Unique()
+		{
+			Reset();
+		}
+
+		/*
+		* Destroys the held object and constructs a T from Arguments, inline when it fits.
+		*/
+		template <typename T, typename... ArgT>
+		T* Emplace(ArgT&&... Arguments)
+		{
+			static_assert(is_convertible_v<T*, Base*>, "T must derive publicly from Base.");
+			Reset();
+			T* object;
+			if constexpr (fits_inline<T>)
+				object = new (_storage) T(Forward<ArgT>(Arguments)...);
+			else
+				object = new T(Forward<ArgT>(Arguments)...);
+			_object = object;
+			_ptr = object;
+			_ops = Inline_Operations::For<T>();
+			return object;
+		}
+
+		void Reset()
+		{
+			if (_ptr)
+			{
+				if (IsInline())
+					_ops->destroy(_object);
+				else
+					_ops->destroyHeap(_object);
+				_ptr = nullptr;
+				_object = nullptr;
+				_ops = nullptr;
+			}
+		}
+
+		bool IsInline() const noexcept
+		{
+			return _object == static_cast<const void*>(_storage);
+		}
+
+		bool Valid() const noexcept
+		{
+			return _ptr != nullptr;
+		}
+
+		Base* Get() const noexcept
+		{
+			return _ptr;
+		}
+
+		Base* operator ->() const noexcept
+		{
+			return _ptr;
+		}
+
+		Base& operator *() const noexcept
+		{
+			return *_ptr;
+		}
+
+		Inline_Unique(const Inline_Unique&) = delete;
+		Inline_Unique& operator =(const Inline_Unique&) = delete;
+	};
+
+	/*
+	* Makes an Inline_Unique<Base, Capacity> holding a T constructed from Arguments.
+	*/
+	template <typename Base, typename T = Base, size_t Capacity = 64, typename... ArgT>
+	[[nodiscard]] auto Make_Inline(ArgT&&... Arguments) -> Inline_Unique<Base, Capacity>
+	{
+		Inline_Unique<Base, Capacity> _init;
+		_init.template Emplace<T>(Forward<ArgT>(Arguments)...);
+		return _init;
+	}
+#pragma endregion Inline_Unique
+}
+
+#endif INLINE_UNIQUE_H
\ No newline at end of file
@@ -0,0 +1,166 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "Smart_Pointers.h"
+#include "Type_Traits.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ACBYTES
+{
+#pragma region Mapped_File
+	enum class Map_Access
+	{
+		READ,
+		READ_WRITE, //Writes reach the file.
+		COPY_ON_WRITE //Writable, writes stay private to the mapping.
+	};
+
+	enum class Access_Hint
+	{
+		NORMAL,
+		SEQUENTIAL,
+		RANDOM,
+		WILL_NEED,
+		DONT_NEED //Pages are dropped and reread from the file, discarding COPY_ON_WRITE changes.
+	};
+
+	/*
+	* Unmaps the region a Mapped_Ptr views.
+	*/
+	template <typename T>
+	struct Unmap_Deleter
+	{
+		size_t bytes = 0; //Mapping length, may exceed Size() * sizeof(T) by a partial trailing element.
+
+		void operator()(T* Ptr) const
+		{
+			auto address = const_cast<void*>(static_cast<const void*>(Ptr));
+#ifdef _WIN32
+			UnmapViewOfFile(address);
+#else
+			munmap(address, bytes);
+#endif
+		}
+	};
+
+	/*
+	* Owns a file mapping viewed as an array of T, with the same Get/Size/operator[] surface as Unique_Ptr<T[]>.
+	* To_Shared turns it into a Shared_Ptr<T[]> that unmaps when the last owner goes away.
+	*/
+	template <typename T>
+	using Mapped_Ptr = Unique_Ptr<T[], Unmap_Deleter<T>>;
+
+	/*
+	* Maps the whole file at Path. Size() is the file size in whole T's. Returns an empty pointer if the file can't be opened or mapped, or is empty.
+	* @param T [Element type, const T for read-only access].
+	* @param Access [Whether and how the mapping is writable].
+	*/
+	template <typename T>
+	[[nodiscard]] Mapped_Ptr<T> Map_File(const char* Path, Map_Access Access = Map_Access::READ)
+	{
+		static_assert(is_trivially_copyable_v<remove_const_t<T>>, "Mapped files can only be viewed as trivially copyable types.");
+
+		void* address = nullptr;
+		size_t bytes = 0;
+#ifdef _WIN32
+		auto write = Access == Map_Access::READ_WRITE;
+		auto file = CreateFileA(Path, GENERIC_READ | (write ? GENERIC_WRITE : 0), FILE_SHARE_READ | (write ? FILE_SHARE_WRITE : 0), nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return Mapped_Ptr<T>();
+
+		LARGE_INTEGER fileSize;
+		if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+		{
+			DWORD protection = Access == Map_Access::READ ? PAGE_READONLY : (write ? PAGE_READWRITE : PAGE_WRITECOPY);
+			auto mapping = CreateFileMappingA(file, nullptr, protection, 0, 0, nullptr);
+			if (mapping)
+			{
+				DWORD view = Access == Map_Access::READ ? FILE_MAP_READ : (write ? FILE_MAP_WRITE : FILE_MAP_COPY);
+				address = MapViewOfFile(mapping, view, 0, 0, 0);
+				bytes = static_cast<size_t>(fileSize.QuadPart);
+				CloseHandle(mapping); //The view keeps the mapping alive.
+			}
+		}
+		CloseHandle(file);
+#else
+		auto file = open(Path, Access == Map_Access::READ_WRITE ? O_RDWR : O_RDONLY);
+		if (file < 0)
+			return Mapped_Ptr<T>();
+
+		struct stat status;
+		if (fstat(file, &status) == 0 && status.st_size > 0)
+		{
+			bytes = static_cast<size_t>(status.st_size);
+			auto protection = Access == Map_Access::READ ? PROT_READ : PROT_READ | PROT_WRITE;
+			address = mmap(nullptr, bytes, protection, Access == Map_Access::COPY_ON_WRITE ? MAP_PRIVATE : MAP_SHARED, file, 0);
+			if (address == MAP_FAILED)
+				address = nullptr;
+		}
+		close(file); //The mapping keeps the file alive.
+#endif
+		if (!address)
+			return Mapped_Ptr<T>();
+		return Mapped_Ptr<T>(static_cast<T*>(address), bytes / sizeof(T), Unmap_Deleter<T>{ bytes });
+	}
+
+	/*
+	* Tells the OS how [Offset, Offset + Count) elements of a mapping will be accessed. Windows only acts on WILL_NEED, by prefetching.
+	* @param Target [Mapped_Ptr, or a Shared_Ptr<T[]> made from one].
+	* @param Count [Number of elements, 0 for everything from Offset on].
+	*/
+	template <typename Array>
+	bool Advise(const Array& Target, Access_Hint Hint, size_t Offset = 0, size_t Count = 0)
+	{
+		using type = array_element_t<const Array>;
+		if (!Target.Get() || Offset >= Target.Size())
+			return false;
+		if (Count == 0 || Count > Target.Size() - Offset)
+			Count = Target.Size() - Offset;
+
+		auto begin = reinterpret_cast<uintptr_t>(Target.Get() + Offset);
+		auto end = begin + Count * sizeof(type);
+#ifdef _WIN32
+		if (Hint != Access_Hint::WILL_NEED)
+			return true;
+		WIN32_MEMORY_RANGE_ENTRY range{ reinterpret_cast<void*>(begin), end - begin };
+		return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != 0;
+#else
+		auto page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+		begin &= ~(page - 1); //madvise wants page aligned addresses.
+		int advice = MADV_NORMAL;
+		switch (Hint)
+		{
+		case Access_Hint::SEQUENTIAL:
+			advice = MADV_SEQUENTIAL;
+			break;
+		case Access_Hint::RANDOM:
+			advice = MADV_RANDOM;
+			break;
+		case Access_Hint::WILL_NEED:
+			advice = MADV_WILLNEED;
+			break;
+		case Access_Hint::DONT_NEED:
+			advice = MADV_DONTNEED;
+			break;
+		default:
+			break;
+		}
+		return madvise(reinterpret_cast<void*>(begin), end - begin, advice) == 0;
+#endif
+	}
+#pragma endregion Mapped_File
+}
+
+#endif MAPPED_FILE_H
\ No newline at end of file
@@ -0,0 +1,341 @@
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "Smart_Pointers.h"
+#include "Type_Traits.h"
+#include "Concurrent_Queue.h"
+
+namespace ACBYTES
+{
+#pragma region Object_Pool
+	template <typename T, typename = void>
+	struct has_reset_member
+	{
+		static constexpr bool value = false;
+	};
+
+	template <typename T>
+	struct has_reset_member<T, decltype(Declval<T&>().Reset(), void())>
+	{
+		static constexpr bool value = true;
+	};
+
+	/*
+	* Calls T::Reset() on recycled objects when T has one.
+	*/
+	template <typename T>
+	struct Default_Pool_Reset
+	{
+		void operator()(T& Object) const
+		{
+			if constexpr (has_reset_member<T>::value)
+				Object.Reset();
+		}
+	};
+
+	template <typename T, typename Reset = Default_Pool_Reset<T>>
+	class Object_Pool;
+
+	/*
+	* Unique_Ptr deleter handing the object back to the pool it came from.
+	*/
+	template <typename T, typename Reset = Default_Pool_Reset<T>>
+	struct Pool_Deleter
+	{
+		Object_Pool<T, Reset>* pool = nullptr;
+
+		Pool_Deleter() noexcept
+		{
+		}
+
+		Pool_Deleter(Object_Pool<T, Reset>* Pool) noexcept : pool(Pool)
+		{
+		}
+
+		void operator()(T* Ptr) const
+		{
+			if (pool)
+				pool->Recycle(Ptr);
+			else
+				delete Ptr; //Default constructed, no pool to return to.
+		}
+	};
+
+	template <typename T, typename Reset = Default_Pool_Reset<T>>
+	using Pooled_Ptr = Unique_Ptr<T, Pool_Deleter<T, Reset>>;
+
+	struct Pool_Statistics
+	{
+		size_t pooled; //Idle objects, approximate while the pool is in use.
+		uint64_t hits;
+		uint64_t misses;
+	};
+
+	/*
+	* One thread's cache for one Object_Pool. The thread owns it; the pool links to it until the thread exits, or marks it orphaned
+	* when the pool is destroyed first so the thread frees it.
+	*/
+	struct Pool_Cache_Base
+	{
+		const uint64_t poolId;
+		std::atomic<bool> orphaned{ false };
+
+		explicit Pool_Cache_Base(uint64_t PoolId) noexcept : poolId(PoolId)
+		{
+		}
+
+		virtual ~Pool_Cache_Base()
+		{
+		}
+
+		//Hands the idle objects to the pool's overflow queue and unlinks the cache. Called under linkMutex while the pool lives.
+		virtual void Retire() = 0;
+	};
+
+	/*
+	* The caches of every Object_Pool a thread used. Flushes them into their pools when the thread exits,
+	* and drops the caches of pools destroyed meanwhile whenever a lookup misses.
+	*/
+	class Pool_Thread_Caches
+	{
+		std::vector<Pool_Cache_Base*> _caches;
+		Pool_Cache_Base* _last = nullptr;
+
+	public:
+		inline static std::mutex linkMutex; //Guards the links between pools and thread caches.
+
+		static Pool_Thread_Caches& Local()
+		{
+			static thread_local Pool_Thread_Caches caches;
+			return caches;
+		}
+
+		//Pool ids are never reused, so caches of destroyed pools can't match a new pool at the same address.
+		static uint64_t NextPoolId() noexcept
+		{
+			static std::atomic<uint64_t> id{ 0 };
+			return id.fetch_add(1, std::memory_order_relaxed) + 1;
+		}
+
+		Pool_Cache_Base* Find(uint64_t PoolId) noexcept
+		{
+			if (_last && _last->poolId == PoolId)
+				return _last;
+			for (size_t i = 0; i < _caches.size();)
+			{
+				auto cache = _caches[i];
+				if (cache->orphaned.load(std::memory_order_acquire))
+				{
+					if (_last == cache)
+						_last = nullptr;
+					_caches[i] = _caches.back();
+					_caches.pop_back();
+					delete cache;
+				}
+				else if (cache->poolId == PoolId)
+					return _last = cache;
+				else
+					i++;
+			}
+			return nullptr;
+		}
+
+		void Add(Pool_Cache_Base* Cache)
+		{
+			_caches.push_back(Cache);
+			_last = Cache;
+		}
+
+		~Pool_Thread_Caches()
+		{
+			std::lock_guard<std::mutex> mLock(linkMutex);
+			for (auto cache : _caches)
+			{
+				if (!cache->orphaned.load(std::memory_order_relaxed))
+					cache->Retire();
+				delete cache;
+			}
+		}
+	};
+
+	/*
+	* Recycles objects that are expensive to construct. Acquire hands out a Pooled_Ptr whose deleter resets the object and puts it back.
+	* Each thread keeps a small free list of its own; it spills to and refills from a lock-free global overflow queue in batches,
+	* and is flushed into the queue when the thread exits. Objects that don't fit into the overflow queue either are deleted. The pool must outlive every Pooled_Ptr it handed out.
+	* @param T [Pooled type].
+	* @param Reset [Callable restoring a recycled object to a reusable state].
+	*/
+	template <typename T, typename Reset>
+	class Object_Pool
+	{
+		static constexpr size_t local_capacity = 32;
+		static constexpr size_t transfer_size = local_capacity / 2;
+
+		friend struct Pool_Deleter<T, Reset>;
+
+		struct Thread_Cache final : Pool_Cache_Base
+		{
+			Object_Pool* pool;
+			T* items[local_capacity];
+			std::atomic<size_t> count{ 0 };
+			std::atomic<uint64_t> hits{ 0 };
+			std::atomic<uint64_t> misses{ 0 };
+
+			explicit Thread_Cache(Object_Pool* Pool) noexcept : Pool_Cache_Base(Pool->_id), pool(Pool)
+			{
+			}
+
+			//Only the owning thread writes, no read-modify-write needed.
+			static void Increment(std::atomic<uint64_t>& Counter) noexcept
+			{
+				Counter.store(Counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			}
+
+			void Retire() override
+			{
+				auto idle = count.load(std::memory_order_relaxed);
+				Unique_Ptr<T> batch[local_capacity];
+				for (size_t i = 0; i < idle; i++)
+					batch[i].Reset(items[i]);
+				pool->_overflow.Push(batch, idle); //Whatever doesn't fit is deleted with batch.
+				pool->_retiredHits += hits.load(std::memory_order_relaxed);
+				pool->_retiredMisses += misses.load(std::memory_order_relaxed);
+				auto& caches = pool->_caches;
+				for (auto& cache : caches)
+				{
+					if (cache == this)
+					{
+						cache = caches.back();
+						caches.pop_back();
+						break;
+					}
+				}
+			}
+		};
+
+		uint64_t _id;
+		NO_UNIQUE_ADDRESS Reset _reset;
+		MPMC_Queue<T> _overflow;
+		std::vector<Thread_Cache*> _caches; //Caches of live threads, guarded by Pool_Thread_Caches::linkMutex.
+		uint64_t _retiredHits = 0; //Totals of caches whose thread exited.
+		uint64_t _retiredMisses = 0;
+
+		Thread_Cache& LocalCache()
+		{
+			auto& caches = Pool_Thread_Caches::Local();
+			if (auto cache = caches.Find(_id))
+				return *static_cast<Thread_Cache*>(cache);
+
+			auto cache = new Thread_Cache(this);
+			{
+				std::lock_guard<std::mutex> mLock(Pool_Thread_Caches::linkMutex);
+				_caches.push_back(cache);
+			}
+			caches.Add(cache);
+			return *cache;
+		}
+
+		void Recycle(T* Object)
+		{
+			_reset(*Object);
+			auto& cache = LocalCache();
+			auto count = cache.count.load(std::memory_order_relaxed);
+			if (count == local_capacity)
+			{
+				Unique_Ptr<T> batch[transfer_size];
+				for (size_t i = 0; i < transfer_size; i++)
+					batch[i].Reset(cache.items[--count]);
+				_overflow.Push(batch, transfer_size); //Whatever doesn't fit is deleted with batch.
+			}
+			cache.items[count++] = Object;
+			cache.count.store(count, std::memory_order_relaxed);
+		}
+
+	public:
+		/*
+		* @param OverflowCapacity [Number of idle objects the shared overflow queue can hold, rounded up to a power of two].
+		*/
+		[[nodiscard]] explicit Object_Pool(size_t OverflowCapacity = 1024) : _id(Pool_Thread_Caches::NextPoolId()), _overflow(OverflowCapacity)
+		{
+		}
+
+		//Threads still caching for the pool free their caches later. The idle objects are deleted outside the lock, their destructors may use pools.
+		~Object_Pool()
+		{
+			std::vector<T*> idle;
+			{
+				std::lock_guard<std::mutex> mLock(Pool_Thread_Caches::linkMutex);
+				for (auto cache : _caches)
+				{
+					auto count = cache->count.load(std::memory_order_relaxed);
+					idle.insert(idle.end(), cache->items, cache->items + count);
+					cache->orphaned.store(true, std::memory_order_release);
+				}
+			}
+			for (auto object : idle)
+				delete object;
+		}
+
+		/*
+		* Hands out an idle object, or constructs a new one with Arguments when none is left.
+		*/
+		template <typename... ArgT>
+		[[nodiscard]] Pooled_Ptr<T, Reset> Acquire(ArgT&&... Arguments)
+		{
+			auto& cache = LocalCache();
+			auto count = cache.count.load(std::memory_order_relaxed);
+			if (count == 0)
+			{
+				Unique_Ptr<T> batch[transfer_size];
+				auto popped = _overflow.Pop(batch, transfer_size);
+				for (size_t i = 0; i < popped; i++)
+				{
+					cache.items[count++] = batch[i].Get();
+					batch[i].Release();
+				}
+			}
+
+			T* object;
+			if (count > 0)
+			{
+				object = cache.items[--count];
+				cache.count.store(count, std::memory_order_relaxed);
+				Thread_Cache::Increment(cache.hits);
+			}
+			else
+			{
+				object = new T(Forward<ArgT>(Arguments)...);
+				Thread_Cache::Increment(cache.misses);
+			}
+			return Pooled_Ptr<T, Reset>(object, Pool_Deleter<T, Reset>(this));
+		}
+
+		/*
+		* Idle object count and hit/miss totals across every thread.
+		*/
+		Pool_Statistics Statistics() const
+		{
+			std::lock_guard<std::mutex> mLock(Pool_Thread_Caches::linkMutex);
+			Pool_Statistics statistics{ _overflow.Size(), _retiredHits, _retiredMisses };
+			for (auto cache : _caches)
+			{
+				statistics.pooled += cache->count.load(std::memory_order_relaxed);
+				statistics.hits += cache->hits.load(std::memory_order_relaxed);
+				statistics.misses += cache->misses.load(std::memory_order_relaxed);
+			}
+			return statistics;
+		}
+
+		Object_Pool(const Object_Pool&) = delete;
+		Object_Pool& operator =(const Object_Pool&) = delete;
+	};
+#pragma endregion Object_Pool
+}
+
+#endif OBJECT_POOL_H
\ No newline at end of file
@@ -0,0 +1,215 @@
+#ifndef POINTER_CAST_H
+#define POINTER_CAST_H
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Smart_Pointers.h"
+#include "Type_Traits.h"
+
+/*
+* Registers a class for Dynamic_Cast/Dynamic_Pointer_Cast, listing its registered direct bases. Place it in a public section.
+* Only non-virtual inheritance is supported. Declares a virtual function, making the class polymorphic.
+*/
+#define TYPE_HIERARCHY(Class, ...) \
+	static void CollectTypeHierarchy(ACBYTES::Type_Table::Builder& Builder, ptrdiff_t Offset) \
+	{ \
+		Builder.Add(ACBYTES::Type_Id_Of<Class>(), Offset); \
+		ACBYTES::Type_Bases<__VA_ARGS__>::template Collect<Class>(Builder, Offset); \
+	} \
+	virtual ACBYTES::Dynamic_Type GetDynamicType() const noexcept \
+	{ \
+		return { &ACBYTES::Type_Table::Of<Class>(), this }; \
+	}
+
+namespace ACBYTES
+{
+#pragma region Type_Table
+	/*
+	* Offsets of a registered class' ancestors (itself included) from the start of its objects, in an open-addressed table
+	* keyed by Type_Id, built once per class. Types reached through more than one path are kept as ambiguous.
+	*/
+	class Type_Table
+	{
+		struct Entry
+		{
+			const void* type = nullptr;
+			ptrdiff_t offset = 0;
+			bool ambiguous = false;
+		};
+
+		std::vector<Entry> _entries;
+		uint64_t _mask = 0;
+
+	public:
+		class Builder
+		{
+			friend class Type_Table;
+
+			std::vector<Entry> _entries;
+			std::vector<uint64_t> _hashes;
+
+		public:
+			void Add(Type_Id Type, ptrdiff_t Offset)
+			{
+				for (auto& entry : _entries)
+				{
+					if (entry.type == Type.Value())
+					{
+						entry.ambiguous = true;
+						return;
+					}
+				}
+				_entries.push_back({ Type.Value(), Offset, false });
+				_hashes.push_back(Type.Hash());
+			}
+		};
+
+		[[nodiscard]] explicit Type_Table(Builder&& Source)
+		{
+			size_t size = 2;
+			while (size < Source._entries.size() * 2)
+				size *= 2;
+			_entries.resize(size);
+			_mask = size - 1;
+			for (size_t i = 0; i < Source._entries.size(); i++)
+			{
+				auto slot = Source._hashes[i] & _mask;
+				while (_entries[slot].type)
+					slot = (slot + 1) & _mask;
+				_entries[slot] = Source._entries[i];
+			}
+		}
+
+		/*
+		* Offset of Type's subobject, nullptr when Type isn't an unambiguous ancestor.
+		*/
+		const ptrdiff_t* Find(Type_Id Type) const noexcept
+		{
+			for (auto slot = Type.Hash() & _mask; _entries[slot].type; slot = (slot + 1) & _mask)
+			{
+				if (_entries[slot].type == Type.Value())
+					return _entries[slot].ambiguous ? nullptr : &_entries[slot].offset;
+			}
+			return nullptr;
+		}
+
+		template <typename Class>
+		static const Type_Table& Of()
+		{
+			static const Type_Table table = []
+			{
+				Builder builder;
+				Class::CollectTypeHierarchy(builder, 0);
+				return Type_Table(Move(builder));
+			}();
+			return table;
+		}
+	};
+
+	/*
+	* Table of an object's most-derived registered class and the address of that class' subobject.
+	*/
+	struct Dynamic_Type
+	{
+		const Type_Table* table;
+		const void* object;
+	};
+
+	/*
+	* Offset of Base's subobject within Class. Only adjusts a pointer, no object is read.
+	*/
+	template <typename Class, typename Base>
+	ptrdiff_t Base_Offset() noexcept
+	{
+		constexpr uintptr_t address = alignof(Class) * 256;
+		return static_cast<ptrdiff_t>(reinterpret_cast<uintptr_t>(static_cast<Base*>(reinterpret_cast<Class*>(address))) - address);
+	}
+
+	template <typename... Bases>
+	struct Type_Bases
+	{
+		template <typename Class>
+		static void Collect(Type_Table::Builder& Builder, [[maybe_unused]] ptrdiff_t Offset)
+		{
+			(Bases::CollectTypeHierarchy(Builder, Offset + Base_Offset<Class, Bases>()), ...);
+		}
+	};
+#pragma endregion Type_Table
+
+#pragma region Dynamic_Cast
+	/*
+	* Casts between classes registered with TYPE_HIERARCHY without RTTI, nullptr when Ptr's object isn't a T.
+	* Upcasts are plain conversions, other casts are a virtual call and a lookup in the object's Type_Table.
+	* @param T [Target type].
+	* @param Ptr [Pointer to a registered class].
+	*/
+	template <typename T, typename T1>
+	T* Dynamic_Cast(T1* Ptr) noexcept
+	{
+		static_assert(is_const_v<T> || !is_const_v<T1>, "Dynamic_Cast can't cast away const.");
+		if constexpr (is_convertible_v<T1*, T*>)
+			return Ptr;
+		else
+		{
+			if (!Ptr)
+				return nullptr;
+			auto type = Ptr->GetDynamicType();
+			auto offset = type.table->Find(Type_Id_Of<remove_cv_t<T>>());
+			return offset ? reinterpret_cast<T*>(const_cast<char*>(static_cast<const char*>(type.object)) + *offset) : nullptr;
+		}
+	}
+
+	/*
+	* Shares Ptr's ownership as a T, empty when Ptr's object isn't a T.
+	*/
+	template <typename T, typename T1>
+	Shared_Ptr<T> Dynamic_Pointer_Cast(const Shared_Ptr<T1>& Ptr) noexcept
+	{
+		auto cast = Dynamic_Cast<T>(Ptr.Get());
+		return cast ? Shared_Ptr<T>(Ptr, cast) : Shared_Ptr<T>();
+	}
+
+	/*
+	* Moves Ptr's ownership to a Shared_Ptr<T>. Ptr is left untouched when its object isn't a T.
+	*/
+	template <typename T, typename T1>
+	Shared_Ptr<T> Dynamic_Pointer_Cast(Shared_Ptr<T1>&& Ptr) noexcept
+	{
+		auto cast = Dynamic_Cast<T>(Ptr.Get());
+		return cast ? Shared_Ptr<T>(Move(Ptr), cast) : Shared_Ptr<T>();
+	}
+
+	/*
+	* Moves Ptr's ownership to a Unique_Ptr<T>. Ptr is left untouched when its object isn't a T.
+	* Default deleters become Default_Delete<T>. Custom ones are kept and receive the T pointer converted back, so they only allow downcasts.
+	*/
+	template <typename T, typename T1, typename Deleter>
+	auto Dynamic_Pointer_Cast(Unique_Ptr<T1, Deleter>&& Ptr) noexcept
+	{
+		constexpr bool default_delete = is_same_v<Deleter, Default_Delete<T1>>;
+		static_assert(default_delete || is_convertible_v<T*, T1*>, "Custom deleters can only be kept through downcasts.");
+		using result = conditional_t<Unique_Ptr<T>, Unique_Ptr<T, Deleter>, default_delete>;
+		auto cast = Dynamic_Cast<T>(Ptr.Get());
+		if constexpr (default_delete)
+		{
+			if (!cast)
+				return result();
+			Ptr.Release();
+			return result(cast);
+		}
+		else
+		{
+			if (!cast)
+				return result(nullptr, Ptr.GetDeleter());
+			result castPtr(cast, Ptr.GetDeleter());
+			Ptr.Release();
+			return castPtr;
+		}
+	}
+#pragma endregion Dynamic_Cast
+}
+
+#endif POINTER_CAST_H
\ No newline at end of file
@@ -3,19 +3,32 @@
 
 #pragma once
 
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
 #include <vector>
 #include <mutex>
+#include <new>
+#include <thread>
 #include "Definitions.h"
 #include "Type_Traits.h"
+#include "Deleter.h"
+#include "Bulk_Memory.h"
 
 namespace ACBYTES
 {
 #pragma region Unique_Ptr
-	template <typename T>
+	/*
+	* @param T [Pointed-to type].
+	* @param Deleter [Callable destroying the pointer, stored without taking space when empty].
+	*/
+	template <typename T, typename Deleter = Default_Delete<T>>
 	class Unique_Ptr
 	{
 		T* _ptr = nullptr;
+		NO_UNIQUE_ADDRESS Deleter _deleter;
 
 	public:
 
@@ -27,55 +40,100 @@ namespace ACBYTES
 		{
 		}
 
-		[[nodiscard]] Unique_Ptr(Unique_Ptr&& Rvr) noexcept
+		[[nodiscard]] Unique_Ptr(T* Ptr, const Deleter& Del) : _ptr(Ptr), _deleter(Del)
+		{
+		}
+
+		[[nodiscard]] Unique_Ptr(Unique_Ptr&& Rvr) noexcept : _deleter(Move(Rvr._deleter))
 		{
 			_ptr = Rvr._ptr;
 			Rvr.Release();
 		}
 
-		template <typename T1, enable_if_t<is_base_of_v<T, T1>, bool> = false>
-		[[nodiscard]] Unique_Ptr(Unique_Ptr<T1>&& Rvr) noexcept
+		template <typename T1, typename Deleter1, enable_if_t<is_convertible_v<T1*, T*> && is_convertible_v<Deleter1, Deleter>, bool> = false>
+		[[nodiscard]] Unique_Ptr(Unique_Ptr<T1, Deleter1>&& Rvr) noexcept : _deleter(Move(Rvr.GetDeleter()))
 		{
-			_ptr = (T*)Rvr.Get();
+			_ptr = Rvr.Get();
 			Rvr.Release();
 		}
 
 		~Unique_Ptr()
 		{
 			if (_ptr)
-				delete _ptr;
+				_deleter(_ptr);
+		}
+
+		Unique_Ptr& operator =(Unique_Ptr&& Rvr) noexcept
+		{
+			if (this != &Rvr)
+			{
+				Reset(Rvr._ptr);
+				_deleter = Move(Rvr._deleter);
+				Rvr.Release();
+			}
+			return *this;
+		}
+
+		template <typename T1, typename Deleter1, enable_if_t<is_convertible_v<T1*, T*> && is_convertible_v<Deleter1, Deleter>, bool> = false>
+		Unique_Ptr& operator =(Unique_Ptr<T1, Deleter1>&& Rvr) noexcept
+		{
+			Reset(Rvr.Get());
+			_deleter = Move(Rvr.GetDeleter());
+			Rvr.Release();
+			return *this;
+		}
+
+		Unique_Ptr& operator =(std::nullptr_t) noexcept
+		{
+			Reset();
+			return *this;
 		}
 
-		void Swap(Unique_Ptr& Ref)
+		void Swap(Unique_Ptr& Ref) noexcept
 		{
 			auto ptr = _ptr;
 			_ptr = Ref._ptr;
 			Ref._ptr = ptr;
+
+			auto deleter = Move(_deleter);
+			_deleter = Move(Ref._deleter);
+			Ref._deleter = Move(deleter);
 		}
 
-		void Release()
+		void Release() noexcept
 		{
 			_ptr = nullptr;
 		}
 
-		void Reset(T* Ptr = nullptr)
+		void Reset(T* Ptr = nullptr) noexcept
 		{
-			if (_ptr)
-				delete _ptr;
-			_ptr = Ptr;
+			auto ptr = _ptr;
+			_ptr = Ptr; //Set first, so the deleter can't reach the old object through this pointer.
+			if (ptr)
+				_deleter(ptr);
+		}
+
+		Deleter& GetDeleter() noexcept
+		{
+			return _deleter;
+		}
+
+		const Deleter& GetDeleter() const noexcept
+		{
+			return _deleter;
 		}
 
-		bool Valid() const
+		bool Valid() const noexcept
 		{
 			return _ptr != nullptr;
 		}
 
-		T* Get() const
+		T* Get() const noexcept
 		{
 			return _ptr;
 		}
 
-		T* operator ->()
+		T* operator ->() const noexcept
 		{
 			return _ptr;
 		}
@@ -84,11 +142,12 @@ namespace ACBYTES
 		Unique_Ptr& operator =(const Unique_Ptr&) = delete;
 	};
 
-	template <typename T>
-	class Unique_Ptr<T[]>
+	template <typename T, typename Deleter>
+	class Unique_Ptr<T[], Deleter>
 	{
 		T* _ptr = nullptr;
-		size_t size;
+		size_t size = 0;
+		NO_UNIQUE_ADDRESS Deleter _deleter;
 
 	public:
 
@@ -100,7 +159,11 @@ namespace ACBYTES
 		{
 		}
 
-		[[nodiscard]] Unique_Ptr(Unique_Ptr&& Rvr) noexcept
+		[[nodiscard]] Unique_Ptr(T* ArrPtr, size_t Size, const Deleter& Del) : _ptr(ArrPtr), size(Size), _deleter(Del)
+		{
+		}
+
+		[[nodiscard]] Unique_Ptr(Unique_Ptr&& Rvr) noexcept : _deleter(Move(Rvr._deleter))
 		{
 			_ptr = Rvr._ptr;
 			size = Rvr.size;
@@ -110,10 +173,27 @@ namespace ACBYTES
 		~Unique_Ptr()
 		{
 			if (_ptr)
-				delete[] _ptr;
+				_deleter(_ptr);
+		}
+
+		Unique_Ptr& operator =(Unique_Ptr&& Rvr) noexcept
+		{
+			if (this != &Rvr)
+			{
+				Reset(Rvr._ptr, Rvr.size);
+				_deleter = Move(Rvr._deleter);
+				Rvr.Release();
+			}
+			return *this;
+		}
+
+		Unique_Ptr& operator =(std::nullptr_t) noexcept
+		{
+			Reset();
+			return *this;
 		}
 
-		void Swap(Unique_Ptr& Ref)
+		void Swap(Unique_Ptr& Ref) noexcept
 		{
 			auto ptr = _ptr;
 			auto _size = size;
@@ -121,41 +201,53 @@ namespace ACBYTES
 			size = Ref.size;
 			Ref._ptr = ptr;
 			Ref.size = _size;
+
+			auto deleter = Move(_deleter);
+			_deleter = Move(Ref._deleter);
+			Ref._deleter = Move(deleter);
 		}
 
-		void Release()
+		void Release() noexcept
 		{
 			_ptr = nullptr;
 			size = 0;
 		}
 
-		void Reset(T* Ptr, size_t Size)
+		void Reset(T* Ptr, size_t Size) noexcept
 		{
-			if (_ptr)
-				delete[] _ptr;
+			auto ptr = _ptr;
 			_ptr = Ptr;
 			size = Size;
+			if (ptr)
+				_deleter(ptr);
 		}
 
-		void Reset(T* Ptr = nullptr) //Unable to resolve size
+		void Reset(T* Ptr = nullptr) noexcept //Unable to resolve size
 		{
-			if (_ptr)
-				delete[] _ptr;
-			_ptr = Ptr;
-			size = size_t();
+			Reset(Ptr, 0);
 		}
 
-		bool Valid() const
+		bool Valid() const noexcept
 		{
 			return _ptr != nullptr;
 		}
 
-		size_t Size() const
+		size_t Size() const noexcept
 		{
 			return size;
 		}
 
-		T* Get() const
+		Deleter& GetDeleter() noexcept
+		{
+			return _deleter;
+		}
+
+		const Deleter& GetDeleter() const noexcept
+		{
+			return _deleter;
+		}
+
+		T* Get() const noexcept
 		{
 			return _ptr;
 		}
@@ -163,10 +255,7 @@ namespace ACBYTES
 		template <size_t ArrSize>
 		void Fill(T(&Array)[ArrSize]) const
 		{
-			for (size_t i = 0; i < ArrSize > size ? size : ArrSize; i++)
-			{
-				Array[i] = *(_ptr + i);
-			}
+			Bulk_Copy(Array, static_cast<const T*>(_ptr), ArrSize < size ? ArrSize : size);
 		}
 
 		T& operator [](size_t Index)
@@ -208,7 +297,7 @@ namespace ACBYTES
 	* Makes unique pointer pointing to an object of type T.
 	*/
 	template <typename T, typename... ArgT, enable_if_t<!is_array_v<T>, bool> = false>
-	[[nodiscard]] auto Make_Unique(ArgT... Arguments) -> Unique_Ptr<T>
+	[[nodiscard]] auto Make_Unique(ArgT&&... Arguments) -> Unique_Ptr<T>
 	{
 		auto _init = new T(Forward<ArgT>(Arguments)...);
 		return Unique_Ptr<T>(_init);
@@ -216,301 +305,1183 @@ namespace ACBYTES
 #pragma endregion Unique_Ptr
 
 #pragma region Shared_Ptr
-	struct IShared_Ref_Counter
+	template <typename T>
+	class Shared_Ptr;
+
+	template <typename T>
+	class Borrowed_Ptr;
+
+	template <typename T>
+	class Weak_Ptr;
+
+	struct IShared_Ref_Counter;
+
+	/*
+	* Passed to the Trace hook of types taking part in cycle collection, which calls it with each Shared_Ptr the object holds:
+	* void Trace(Cycle_Tracer& Tracer) const { Tracer(_parent); Tracer(_next); }
+	*/
+	class Cycle_Tracer
 	{
-		virtual ~IShared_Ref_Counter()
+		friend struct Cycle_Collector;
+
+		std::vector<IShared_Ref_Counter*>* _edges;
+
+		Cycle_Tracer(std::vector<IShared_Ref_Counter*>* Edges) noexcept : _edges(Edges)
 		{
 		}
 
-		virtual bool Dead() = 0;
-		virtual bool operator ==(void* Ptr) = 0;
-		virtual IShared_Ref_Counter& operator ++() = 0;
-		virtual IShared_Ref_Counter& operator --() = 0;
+	public:
+		template <typename T>
+		void operator ()(const Shared_Ptr<T>& Edge) const
+		{
+			if (Edge._counter && Edge._counter->Traceable()) //Untraced objects can't close a cycle.
+				_edges->push_back(Edge._counter);
+		}
+	};
+
+	template <typename T, typename = void>
+	struct has_trace_member
+	{
+		static constexpr bool value = false;
 	};
 
 	template <typename T>
-	struct Shared_Ref_Counter final : public IShared_Ref_Counter
+	struct has_trace_member<T, decltype(Declval<const T&>().Trace(Declval<Cycle_Tracer&>()), void())>
 	{
-	private:
-		uint32_t _count = 1;
-		T* _ptr = nullptr;
+		static constexpr bool value = true;
+	};
 
-	public:
-		Shared_Ref_Counter(T* Ptr) : _ptr(Ptr)
+	enum class Cycle_Color : uint8_t
+	{
+		BLACK, //In use.
+		GRAY, //Possible member of a garbage cycle.
+		WHITE, //Member of a garbage cycle.
+		PURPLE, //Possible root of a garbage cycle.
+		COLLECTING //Being freed by the cycle collector, releases of it are ignored.
+	};
+
+	/*
+	* How Make_Shared counts an object's references.
+	*/
+	enum class Shared_Count : uint8_t
+	{
+		SINGLE, //One atomic count, the default.
+		SHARDED //Per-thread shards for objects copied by many threads at once, see Shared_Count_Shards.
+	};
+
+	/*
+	* Reference count split into cache-line-sized shards, so threads copying and dropping the same object don't contend on one line.
+	* A thread counts in its own shard, which never drops below zero: a release finding its shard empty (the reference was counted
+	* by another thread) falls back to a central count, which keeps at least one. Only a release that would take it to zero can be
+	* the last, so the shards are then frozen and folded into it once, after which the central count is exact and used by every thread.
+	*/
+	class Shared_Count_Shards
+	{
+		static constexpr size_t cache_line_size = 64;
+		static constexpr size_t max_shards = 64;
+		static constexpr int64_t frozen = INT64_MIN / 2; //Shards below zero are frozen.
+		static constexpr int64_t folded = int64_t(1) << 62; //Added to the central count by the fold.
+
+		struct alignas(cache_line_size) Shard
 		{
-		}
+			std::atomic<int64_t> count{ 0 };
+		};
 
-		~Shared_Ref_Counter()
+		std::atomic<int64_t> _central;
+		mutable std::mutex _foldMutex;
+		Shard* _shards;
+		size_t _mask;
+
+		static size_t ShardCount() noexcept
 		{
-			delete _ptr;
+			static const size_t count = []
+			{
+				size_t count = 4;
+				while (count < std::thread::hardware_concurrency() && count < max_shards)
+					count <<= 1;
+				return count;
+			}();
+			return count;
 		}
 
-		bool Dead() override
+		static bool IsFolded(int64_t Central) noexcept
 		{
-			return _count < 1;
+			return Central > folded / 2;
 		}
 
-		bool operator ==(void* Ptr) override
+		Shard& Local() noexcept
 		{
-			return Ptr == _ptr;
+			static std::atomic<size_t> nextSlot{ 0 };
+			static thread_local const size_t slot = nextSlot.fetch_add(1, std::memory_order_relaxed);
+			return _shards[slot & _mask];
 		}
 
-		IShared_Ref_Counter& operator ++() override
+		/*
+		* Freezes the shards and moves their counts to the central count, unless done already.
+		*/
+		void Fold() noexcept
 		{
-			++_count;
-			return *this;
+			std::lock_guard<std::mutex> mLock(_foldMutex);
+			if (IsFolded(_central.load(std::memory_order_acquire)))
+				return;
+			int64_t sum = 0;
+			for (size_t i = 0; i <= _mask; i++)
+				sum += _shards[i].count.exchange(frozen, std::memory_order_acq_rel);
+			_central.fetch_add(sum + folded, std::memory_order_acq_rel);
 		}
 
-		IShared_Ref_Counter& operator --() override
+	public:
+		[[nodiscard]] explicit Shared_Count_Shards(uint32_t Count) : _central(Count), _shards(new Shard[ShardCount()]), _mask(ShardCount() - 1)
 		{
-			--_count;
-			return *this;
 		}
-	};
 
-	template <typename T>
-	struct Shared_Ref_Counter<T[]> final : public IShared_Ref_Counter
-	{
-	private:
-		uint32_t _count = 1;
-		T* _ptr = nullptr;
+		~Shared_Count_Shards()
+		{
+			delete[] _shards;
+		}
 
-	public:
-		Shared_Ref_Counter(T* Ptr) : _ptr(Ptr)
+		void Increment() noexcept
 		{
+			if (Local().count.fetch_add(1, std::memory_order_relaxed) < 0)
+				_central.fetch_add(1, std::memory_order_relaxed);
 		}
 
-		~Shared_Ref_Counter()
+		/*
+		* Drops a reference. Returns whether it was the last one.
+		*/
+		bool Release() noexcept
 		{
-			delete[] _ptr;
+			auto& shard = Local().count;
+			for (auto count = shard.load(std::memory_order_relaxed); count > 0;)
+			{
+				if (shard.compare_exchange_weak(count, count - 1, std::memory_order_release, std::memory_order_relaxed))
+					return false;
+			}
+			auto central = _central.load(std::memory_order_relaxed);
+			while (!IsFolded(central) && central > 1)
+			{
+				if (_central.compare_exchange_weak(central, central - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+					return false;
+			}
+			//References counted in other shards may remain. This one is kept until they are folded in, keeping the object alive meanwhile.
+			if (!IsFolded(central))
+				Fold();
+			return _central.fetch_sub(1, std::memory_order_acq_rel) - folded == 1;
 		}
 
-		bool Dead() override
+		/*
+		* Adds a reference unless the count reached zero, see Weak_Ptr::Lock. Before the fold the object can't have died, and an
+		* increment landing in an unfrozen shard is folded in.
+		*/
+		bool TryRetain() noexcept
 		{
-			return _count < 1;
+			if (Local().count.fetch_add(1, std::memory_order_relaxed) >= 0)
+				return true;
+			for (auto central = _central.load(std::memory_order_relaxed); !IsFolded(central) || central - folded > 0;)
+			{
+				if (_central.compare_exchange_weak(central, central + 1, std::memory_order_relaxed))
+					return true;
+			}
+			return false;
 		}
 
-		bool operator ==(void* Ptr) override
+		/*
+		* Central count plus the shards, leaving them in place. Exact unless other threads copy or drop the object meanwhile:
+		* a reference moving from a shard not read yet to one already read is missed, one moving the other way is counted twice.
+		*/
+		uint32_t Count() const noexcept
 		{
-			return Ptr == _ptr;
+			auto central = _central.load(std::memory_order_acquire);
+			if (IsFolded(central))
+				return static_cast<uint32_t>(central - folded);
+			for (size_t i = 0; i <= _mask; i++)
+			{
+				auto count = _shards[i].count.load(std::memory_order_acquire);
+				if (count < 0) //Being folded, the central count is exact once that's done.
+				{
+					std::lock_guard<std::mutex> mLock(_foldMutex);
+					return static_cast<uint32_t>(_central.load(std::memory_order_acquire) - folded);
+				}
+				central += count;
+			}
+			return static_cast<uint32_t>(central);
 		}
 
-		IShared_Ref_Counter& operator ++() override
+		/*
+		* Whether the caller's reference is the only one. A count that reads as one is confirmed by folding the shards, since
+		* Count can miss references other holders are handing between threads; the object is counted centrally from then on.
+		*/
+		bool Unique() noexcept
 		{
-			++_count;
-			return *this;
+			if (Count() != 1)
+				return false;
+			Fold();
+			return _central.load(std::memory_order_acquire) - folded == 1;
 		}
 
-		IShared_Ref_Counter& operator --() override
+		bool Dead() const noexcept
 		{
-			--_count;
-			return *this;
+			auto central = _central.load(std::memory_order_acquire);
+			return IsFolded(central) && central - folded < 1;
 		}
+
+		Shared_Count_Shards(const Shared_Count_Shards&) = delete;
+		Shared_Count_Shards& operator =(const Shared_Count_Shards&) = delete;
 	};
 
-	struct Shared_Ptr_Container final
+	/*
+	* Reference count shared by every Shared_Ptr of an object. Shared_Ptrs keep a pointer to their counter,
+	* so copying, destroying and querying the count don't search the registry.
+	*/
+	struct IShared_Ref_Counter
 	{
-	public:
-		NO_DEFAULT_CONSTRUCTORS(Shared_Ptr_Container);
-		template <typename> friend class Shared_Ptr;
+		friend struct Shared_Ptr_Container;
+		friend struct Cycle_Collector;
+
+	protected:
+		std::atomic<uint32_t> _count;
+		Shared_Count_Shards* _shards; //Replaces _count when sharded.
+		std::atomic<uint32_t> _weak{ 1 }; //Weak_Ptrs, plus one held by all Shared_Ptrs together. The counter lives until it drops to zero.
 
 	private:
-		static std::vector<IShared_Ref_Counter*> references;
-		static const size_t reserve_size = 4;
+		static constexpr size_t no_root = ~size_t(0);
+		static constexpr size_t unregistered = ~size_t(0);
 
-		static std::mutex referenceMutex;
+		size_t _referenceIndex = unregistered; //Slot in the registry, guarded by its mutex.
 
-		static void CheckReserve()
+		//Cycle collection state, guarded by the collector's mutex.
+		const bool _traceable;
+		Cycle_Color _color = Cycle_Color::BLACK;
+		uint32_t _trial = 0; //Count left after trial deletion of the references from inside the traced graph.
+		size_t _rootIndex = no_root;
+#if ACBYTES_DEBUG
+		std::atomic<uint32_t> _borrows{ 0 }; //Live Borrowed_Ptrs, which must all be gone before the counter is.
+#endif
+
+	public:
+		//Sharded counts aren't traceable: the collector needs exact counts of every member of a graph at once.
+		IShared_Ref_Counter(uint32_t Count = 1, bool Traceable = false, Shared_Count Mode = Shared_Count::SINGLE)
+			: _count(Count), _shards(Mode == Shared_Count::SHARDED ? new Shared_Count_Shards(Count) : nullptr), _traceable(Traceable && !_shards)
 		{
-			references.reserve(references.capacity() - references.size() <= 2 ? reserve_size : 0);
 		}
 
-		template <typename T>
-		static void AddNewReference(T* Ptr, bool IsArray = false)
+		virtual ~IShared_Ref_Counter()
 		{
-			if (Ptr)
-			{
-				CheckReserve();
-				std::lock_guard<std::mutex> mLock(referenceMutex);
-				for (auto i = references.begin(); i != references.end(); i++)
-				{
-					auto& ref = **i;
-					if (ref == Ptr)
-					{
-						++ref;
-						return;
-					}
-				}
-				if (IsArray)
-					references.push_back(new Shared_Ref_Counter<T[]>(Ptr));
-				else
-					references.push_back(new Shared_Ref_Counter<T>(Ptr));
-			}
+			delete _shards;
 		}
 
-		template <typename T>
-		static void RemoveReference(T* Ptr)
+		virtual bool operator ==(void* Ptr) = 0;
+
+		/*
+		* Destroys the object, leaving the counter alive. Called once, by the destructor or by the cycle collector before deleting the counter.
+		*/
+		virtual void Dispose() noexcept = 0;
+
+		/*
+		* Destroys the object once the last Shared_Ptr is gone. Debug builds check that no Borrowed_Ptr is left.
+		*/
+		void Expire() noexcept
 		{
-			if (Ptr)
-			{
-				std::lock_guard<std::mutex> mLock(referenceMutex);
-				for (auto i = references.begin(); i != references.end(); i++)
-				{
-					auto& ref = **i;
-					if (ref == Ptr)
-					{
-						if ((--(ref)).Dead())
-						{
-							delete (*i);
-							references.erase(i);
-						}
-						return;
-					}
-				}
-			}
+#if ACBYTES_DEBUG
+			assert(_borrows.load(std::memory_order_relaxed) == 0 && "A Borrowed_Ptr outlived the object it borrows.");
+#endif
+			Dispose();
 		}
-	};
-
-	std::vector<IShared_Ref_Counter*> Shared_Ptr_Container::references = std::vector<IShared_Ref_Counter*>();
-	std::mutex Shared_Ptr_Container::referenceMutex;
 
-	template <typename T>
-	class Shared_Ptr
-	{
-		T* _ptr = nullptr;
+		/*
+		* Reports the counters of the Shared_Ptrs the object holds, for types with a Trace hook.
+		*/
+		virtual void Trace(Cycle_Tracer&)
+		{
+		}
 
-	public:
+		bool Traceable() const noexcept
+		{
+			return _traceable;
+		}
 
-		[[nodiscard]] Shared_Ptr(std::nullptr_t = nullptr) //Empty pointer.
+		bool Collecting() const noexcept
 		{
+			return _color == Cycle_Color::COLLECTING;
 		}
 
-		[[nodiscard]] Shared_Ptr(T* Ptr) : _ptr(Ptr)
+		bool Dead() const noexcept
 		{
-			Shared_Ptr_Container::AddNewReference(Ptr);
+			if (_shards)
+				return _shards->Dead();
+			return _count.load(std::memory_order_acquire) < 1;
 		}
 
-		Shared_Ptr(const Shared_Ptr& Ref)
+		uint32_t Count() const noexcept
 		{
-			_ptr = Ref._ptr;
-			Shared_Ptr_Container::AddNewReference(_ptr);
+			if (_shards)
+				return _shards->Count();
+			return _count.load(std::memory_order_acquire);
 		}
 
-		[[nodiscard]] Shared_Ptr(Shared_Ptr&& Rvr) noexcept
+		bool Unique() noexcept
 		{
-			_ptr = Rvr._ptr;
-			Rvr._ptr = nullptr;
+			if (_shards)
+				return _shards->Unique();
+			return _count.load(std::memory_order_acquire) == 1;
 		}
 
-		template <typename T1, enable_if_t<is_base_of_v<T, T1>, bool> = false>
-		[[nodiscard]] Shared_Ptr(const Shared_Ptr<T1>& Ref)
+		IShared_Ref_Counter& operator ++() noexcept
 		{
-			_ptr = Ref.Get();
-			Shared_Ptr_Container::AddNewReference(_ptr);
+			if (_shards)
+				_shards->Increment();
+			else
+				_count.fetch_add(1, std::memory_order_relaxed);
+			return *this;
 		}
 
-		~Shared_Ptr()
+#if ACBYTES_DEBUG
+		void Borrow() noexcept
 		{
-			Shared_Ptr_Container::RemoveReference(_ptr);
+			_borrows.fetch_add(1, std::memory_order_relaxed);
 		}
 
-		void Swap(Shared_Ptr& Ref)
+		void Return() noexcept
 		{
-			auto ptr = _ptr;
-			_ptr = Ref._ptr;
-			Ref._ptr = ptr;
+			_borrows.fetch_sub(1, std::memory_order_relaxed);
 		}
+#endif
 
-		void Reset(T* Ptr = nullptr)
+		/*
+		* Drops a reference. Returns whether it was the last one.
+		*/
+		bool Release() noexcept
 		{
-			Shared_Ptr_Container::RemoveReference(_ptr);
-			Shared_Ptr_Container::AddNewReference(Ptr);
+			if (_shards)
+				return _shards->Release();
+			return _count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+		}
 
-			_ptr = Ptr;
+		/*
+		* Adds a reference unless the count already reached zero. Traced counters go through Shared_Ptr_Container::TryRetain.
+		*/
+		bool TryRetain() noexcept
+		{
+			if (_shards)
+				return _shards->TryRetain();
+			for (auto count = _count.load(std::memory_order_relaxed); count > 0;)
+			{
+				if (_count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed))
+					return true;
+			}
+			return false;
 		}
 
-		T* Get() const
+		void AddWeak() noexcept
 		{
-			return _ptr;
+			_weak.fetch_add(1, std::memory_order_relaxed);
 		}
 
-		T* operator ->()
+		/*
+		* Drops a weak reference, deleting the counter with the last one.
+		*/
+		void ReleaseWeak() noexcept
 		{
-			return _ptr;
+			if (_weak.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				delete this;
 		}
 	};
 
 	template <typename T>
-	class Shared_Ptr<T[]>
+	struct Shared_Ref_Counter final : public IShared_Ref_Counter
 	{
+	private:
 		T* _ptr = nullptr;
-		size_t size;
 
 	public:
-
-		[[nodiscard]] Shared_Ptr(std::nullptr_t = nullptr) //Empty pointer.
+		Shared_Ref_Counter(T* Ptr) : IShared_Ref_Counter(1, has_trace_member<T>::value), _ptr(Ptr)
 		{
 		}
 
-		[[nodiscard]] Shared_Ptr(T* Ptr, size_t Size) : _ptr(Ptr), size(Size)
+		~Shared_Ref_Counter()
 		{
-			Shared_Ptr_Container::AddNewReference(Ptr, true);
+			Dispose();
 		}
 
-		Shared_Ptr(const Shared_Ptr& Ref)
+		bool operator ==(void* Ptr) override
 		{
-			_ptr = Ref._ptr;
-			size = Ref.Size();
-			Shared_Ptr_Container::AddNewReference(Ref._ptr, true);
+			return Ptr == _ptr;
 		}
 
-		[[nodiscard]] Shared_Ptr(Shared_Ptr&& Rvr) noexcept
+		void Dispose() noexcept override
 		{
-			_ptr = Rvr._ptr;
-			size = Rvr.Size();
-			Rvr._ptr = nullptr;
-			Rvr.size = 0;
+			auto ptr = _ptr;
+			_ptr = nullptr;
+			delete ptr;
 		}
 
-		~Shared_Ptr()
+		void Trace(Cycle_Tracer& Tracer) override
 		{
-			Shared_Ptr_Container::RemoveReference(_ptr);
+			if constexpr (has_trace_member<T>::value)
+			{
+				if (_ptr)
+					_ptr->Trace(Tracer);
+			}
 		}
+	};
+
+	template <typename T>
+	struct Shared_Ref_Counter<T[]> final : public IShared_Ref_Counter
+	{
+	private:
+		T* _ptr = nullptr;
 
-		void Swap(Shared_Ptr& Ref)
+	public:
+		Shared_Ref_Counter(T* Ptr) : _ptr(Ptr)
 		{
-			auto ptr = _ptr;
-			auto _size = size;
-			_ptr = Ref._ptr;
-			size = Ref.size;
-			Ref._ptr = ptr;
-			Ref.size = _size;
 		}
 
-		void Reset(T* Ptr, size_t Size)
+		~Shared_Ref_Counter()
 		{
-			Shared_Ptr_Container::RemoveReference(_ptr);
-			Shared_Ptr_Container::AddNewReference(Ptr);
-
-			_ptr = Ptr;
-			size = Size;
+			Dispose();
 		}
 
-		void Reset(T* Ptr = nullptr) //Unable to resolve size
+		bool operator ==(void* Ptr) override
 		{
-			Shared_Ptr_Container::RemoveReference(_ptr);
-			Shared_Ptr_Container::AddNewReference(Ptr);
-
-			_ptr = Ptr;
-			size = 0;
+			return Ptr == _ptr;
 		}
 
-		size_t Size() const
+		void Dispose() noexcept override
 		{
-			return size;
+			auto ptr = _ptr;
+			_ptr = nullptr;
+			delete[] ptr;
+		}
+	};
+
+	/*
+	* Reference counter that also stores the object, so Make_Shared needs a single allocation.
+	*/
+	template <typename T>
+	struct Shared_Inplace_Counter final : public IShared_Ref_Counter
+	{
+	private:
+		alignas(T) unsigned char _storage[sizeof(T)];
+		bool _alive = true;
+
+		template <typename... ArgT>
+		Shared_Inplace_Counter(Shared_Count Mode, ArgT&&... Arguments) : IShared_Ref_Counter(1, has_trace_member<T>::value, Mode)
+		{
+			new (_storage) T(Forward<ArgT>(Arguments)...);
+		}
+
+	public:
+		/*
+		* Allocates the counter and the object together, registers the counter and returns the first Shared_Ptr owning it.
+		*/
+		template <Shared_Count Mode = Shared_Count::SINGLE, typename... ArgT>
+		static Shared_Ptr<T> Create(ArgT&&... Arguments);
+
+		~Shared_Inplace_Counter()
+		{
+			Dispose();
+		}
+
+		T* Get()
+		{
+			return reinterpret_cast<T*>(_storage);
+		}
+
+		bool operator ==(void* Ptr) override
+		{
+			return _alive && Ptr == _storage;
+		}
+
+		void Dispose() noexcept override
+		{
+			if (_alive)
+			{
+				_alive = false;
+				Get()->~T();
+			}
+		}
+
+		void Trace(Cycle_Tracer& Tracer) override
+		{
+			if constexpr (has_trace_member<T>::value)
+			{
+				if (_alive)
+					Get()->Trace(Tracer);
+			}
+		}
+	};
+
+	/*
+	* Reference counter destroying the object with the deleter of the Unique_Ptr it was taken from, see To_Shared.
+	*/
+	template <typename T, typename Deleter>
+	struct Shared_Deleter_Counter final : public IShared_Ref_Counter
+	{
+	private:
+		T* _ptr;
+		NO_UNIQUE_ADDRESS Deleter _deleter;
+
+		Shared_Deleter_Counter(T* Ptr, Deleter&& Del, bool Traceable) : IShared_Ref_Counter(1, Traceable), _ptr(Ptr), _deleter(Move(Del))
+		{
+		}
+
+	public:
+		/*
+		* Takes over Unique's object and deleter, registers the counter and returns the first Shared_Ptr owning it.
+		*/
+		static Shared_Ptr<T> Share(Unique_Ptr<T, Deleter>&& Unique);
+		static Shared_Ptr<T[]> Share(Unique_Ptr<T[], Deleter>&& Unique);
+
+		~Shared_Deleter_Counter()
+		{
+			Dispose();
+		}
+
+		bool operator ==(void* Ptr) override
+		{
+			return Ptr == _ptr;
+		}
+
+		void Dispose() noexcept override
+		{
+			if (_ptr)
+			{
+				auto ptr = _ptr;
+				_ptr = nullptr;
+				_deleter(ptr);
+			}
+		}
+
+		void Trace(Cycle_Tracer& Tracer) override
+		{
+			if constexpr (has_trace_member<T>::value)
+			{
+				if (_ptr)
+					_ptr->Trace(Tracer);
+			}
+		}
+	};
+
+	struct Shared_Ptr_Container final
+	{
+	public:
+		NO_DEFAULT_CONSTRUCTORS(Shared_Ptr_Container);
+		template <typename> friend class Shared_Ptr;
+		template <typename> friend class Weak_Ptr;
+		template <typename> friend struct Shared_Inplace_Counter;
+		template <typename, typename> friend struct Shared_Deleter_Counter;
+		friend struct Cycle_Collector;
+
+	private:
+		inline static std::vector<IShared_Ref_Counter*> references;
+		static const size_t reserve_size = 4;
+
+		inline static std::mutex referenceMutex;
+
+		static void CheckReserve()
+		{
+			references.reserve(references.capacity() - references.size() <= 2 ? reserve_size : 0);
+		}
+
+		/*
+		* Finds the counter of Ptr and adds a reference to it, or registers a new counter for it.
+		*/
+		template <typename T>
+		static IShared_Ref_Counter* AddNewReference(T* Ptr, bool IsArray = false)
+		{
+			if (Ptr)
+			{
+				std::lock_guard<std::mutex> mLock(referenceMutex);
+				for (auto i = references.begin(); i != references.end(); i++)
+				{
+					auto& ref = **i;
+					if (ref == Ptr)
+					{
+						++ref; //May revive a counter whose last owner is on its way to RemoveReference, which then keeps it.
+						return &ref;
+					}
+				}
+				IShared_Ref_Counter* counter;
+				if (IsArray)
+					counter = new Shared_Ref_Counter<T[]>(Ptr);
+				else
+					counter = new Shared_Ref_Counter<T>(Ptr);
+				Register(counter);
+				return counter;
+			}
+			return nullptr;
+		}
+
+		//Caller holds referenceMutex.
+		static void Register(IShared_Ref_Counter* Counter)
+		{
+			CheckReserve();
+			Counter->_referenceIndex = references.size();
+			references.push_back(Counter);
+		}
+
+		static void AddNewCounter(IShared_Ref_Counter* Counter)
+		{
+			std::lock_guard<std::mutex> mLock(referenceMutex);
+			Register(Counter);
+		}
+
+		/*
+		* Takes Counter out of the registry in constant time, moving the last entry into its slot. Returns whether it did;
+		* with IfDead, only if nobody revived the counter meanwhile.
+		*/
+		static bool Unregister(IShared_Ref_Counter* Counter, bool IfDead)
+		{
+			std::lock_guard<std::mutex> mLock(referenceMutex);
+			auto index = Counter->_referenceIndex;
+			if (index == IShared_Ref_Counter::unregistered || (IfDead && !Counter->Dead()))
+				return false;
+			references[index] = references.back();
+			references[index]->_referenceIndex = index;
+			references.pop_back();
+			Counter->_referenceIndex = IShared_Ref_Counter::unregistered;
+			return true;
+		}
+
+		/*
+		* Drops a reference. Only the owner releasing the last reference locks the registry. The object is destroyed after unlocking,
+		* since that may release Shared_Ptrs it holds, and the counter once no Weak_Ptr is left.
+		*/
+		static void RemoveReference(IShared_Ref_Counter* Counter);
+
+		/*
+		* Adds a reference to a possibly dead object, failing if it's dead or being freed by the cycle collector.
+		*/
+		static bool TryRetain(IShared_Ref_Counter* Counter);
+
+		static bool Expired(IShared_Ref_Counter* Counter);
+	};
+
+	/*
+	* Synchronous trial deletion cycle collector (Bacon and Rajan) for objects whose type has a Trace hook:
+	* void Trace(Cycle_Tracer& Tracer) const, calling Tracer with every Shared_Ptr member.
+	* Releasing a traced object's reference without freeing it buffers the counter as a possible cycle root; Collect frees the
+	* garbage cycles reachable from the buffered roots. Objects of untraced types are never collected and can't close a cycle.
+	* Shared_Ptr members of the objects being traced must not change during Collect.
+	*/
+	struct Cycle_Collector final
+	{
+	public:
+		NO_DEFAULT_CONSTRUCTORS(Cycle_Collector);
+		friend struct Shared_Ptr_Container;
+
+	private:
+		inline static std::vector<IShared_Ref_Counter*> roots;
+		inline static std::mutex collectorMutex;
+
+		static void Buffer(IShared_Ref_Counter* Counter)
+		{
+			Counter->_color = Cycle_Color::PURPLE;
+			if (Counter->_rootIndex == IShared_Ref_Counter::no_root)
+			{
+				Counter->_rootIndex = roots.size();
+				roots.push_back(Counter);
+			}
+		}
+
+		static void Unbuffer(IShared_Ref_Counter* Counter)
+		{
+			auto index = Counter->_rootIndex;
+			if (index != IShared_Ref_Counter::no_root)
+			{
+				roots[index] = roots.back();
+				roots[index]->_rootIndex = index;
+				roots.pop_back();
+				Counter->_rootIndex = IShared_Ref_Counter::no_root;
+			}
+		}
+
+		/*
+		* Drops a reference to a traced object. Returns whether it was the last one and the counter should be freed.
+		*/
+		static bool Release(IShared_Ref_Counter* Counter)
+		{
+			std::lock_guard<std::mutex> mLock(collectorMutex);
+			if (Counter->Collecting()) //Released by a garbage object being destroyed, Collect frees it.
+				return false;
+			if (!Counter->Release())
+			{
+				Buffer(Counter);
+				return false;
+			}
+			Unbuffer(Counter);
+			Counter->_color = Cycle_Color::BLACK;
+			return true;
+		}
+
+		static bool TryRetain(IShared_Ref_Counter* Counter)
+		{
+			std::lock_guard<std::mutex> mLock(collectorMutex);
+			return !Counter->Collecting() && Counter->TryRetain();
+		}
+
+		static bool Expired(IShared_Ref_Counter* Counter)
+		{
+			std::lock_guard<std::mutex> mLock(collectorMutex);
+			return Counter->Collecting() || Counter->Dead();
+		}
+
+		static void Edges(IShared_Ref_Counter* Counter, std::vector<IShared_Ref_Counter*>& Edges)
+		{
+			Edges.clear();
+			Cycle_Tracer tracer(&Edges);
+			Counter->Trace(tracer);
+		}
+
+		/*
+		* Subtracts the references coming from inside the graph reachable from Root, coloring it gray.
+		*/
+		static void MarkGray(IShared_Ref_Counter* Root, std::vector<IShared_Ref_Counter*>& Stack, std::vector<IShared_Ref_Counter*>& Children)
+		{
+			if (Root->_color == Cycle_Color::GRAY)
+				return;
+			Root->_color = Cycle_Color::GRAY;
+			Root->_trial = Root->Count();
+			Stack.push_back(Root);
+			while (!Stack.empty())
+			{
+				auto node = Stack.back();
+				Stack.pop_back();
+				Edges(node, Children);
+				for (auto child : Children)
+				{
+					if (child->_color != Cycle_Color::GRAY)
+					{
+						child->_color = Cycle_Color::GRAY;
+						child->_trial = child->Count();
+						Stack.push_back(child);
+					}
+					child->_trial--;
+				}
+			}
+		}
+
+		/*
+		* Recolors everything reachable from an externally referenced node black.
+		*/
+		static void ScanBlack(IShared_Ref_Counter* Node, std::vector<IShared_Ref_Counter*>& Stack, std::vector<IShared_Ref_Counter*>& Children)
+		{
+			Node->_color = Cycle_Color::BLACK;
+			Stack.push_back(Node);
+			while (!Stack.empty())
+			{
+				auto node = Stack.back();
+				Stack.pop_back();
+				Edges(node, Children);
+				for (auto child : Children)
+				{
+					if (child->_color != Cycle_Color::BLACK)
+					{
+						child->_color = Cycle_Color::BLACK;
+						Stack.push_back(child);
+					}
+				}
+			}
+		}
+
+		/*
+		* Colors gray nodes left without outside references white, and the rest black again.
+		*/
+		static void Scan(IShared_Ref_Counter* Root, std::vector<IShared_Ref_Counter*>& Stack, std::vector<IShared_Ref_Counter*>& Children)
+		{
+			std::vector<IShared_Ref_Counter*> pending{ Root };
+			while (!pending.empty())
+			{
+				auto node = pending.back();
+				pending.pop_back();
+				if (node->_color != Cycle_Color::GRAY)
+					continue;
+				if (node->_trial > 0)
+					ScanBlack(node, Stack, Children);
+				else
+				{
+					node->_color = Cycle_Color::WHITE;
+					Edges(node, Children);
+					pending.insert(pending.end(), Children.begin(), Children.end());
+				}
+			}
+		}
+
+		/*
+		* Moves the white nodes reachable from Root into Garbage.
+		*/
+		static void CollectWhite(IShared_Ref_Counter* Root, std::vector<IShared_Ref_Counter*>& Garbage, std::vector<IShared_Ref_Counter*>& Children)
+		{
+			std::vector<IShared_Ref_Counter*> pending{ Root };
+			while (!pending.empty())
+			{
+				auto node = pending.back();
+				pending.pop_back();
+				if (node->_color != Cycle_Color::WHITE)
+					continue;
+				node->_color = Cycle_Color::COLLECTING;
+				Unbuffer(node); //Buffered as a root of a later batch.
+				Garbage.push_back(node);
+				Edges(node, Children);
+				pending.insert(pending.end(), Children.begin(), Children.end());
+			}
+		}
+
+	public:
+		/*
+		* Frees the garbage cycles reachable from up to MaxRoots buffered roots. Returns the number of objects freed.
+		* @param MaxRoots [Bounds the work done by one call, the remaining roots are kept for later calls].
+		*/
+		static size_t Collect(size_t MaxRoots = ~size_t(0))
+		{
+			std::vector<IShared_Ref_Counter*> garbage;
+			{
+				std::lock_guard<std::mutex> mLock(collectorMutex);
+				auto taken = roots.size() < MaxRoots ? roots.size() : MaxRoots;
+				std::vector<IShared_Ref_Counter*> batch(roots.end() - taken, roots.end());
+				roots.resize(roots.size() - taken);
+				for (auto root : batch)
+					root->_rootIndex = IShared_Ref_Counter::no_root;
+
+				std::vector<IShared_Ref_Counter*> stack;
+				std::vector<IShared_Ref_Counter*> children;
+				for (auto root : batch)
+				{
+					if (root->_color == Cycle_Color::PURPLE)
+						MarkGray(root, stack, children);
+				}
+				for (auto root : batch)
+					Scan(root, stack, children);
+				for (auto root : batch)
+					CollectWhite(root, garbage, children);
+
+				for (auto root : roots) //Tracing may have recolored roots of later batches.
+					root->_color = Cycle_Color::PURPLE;
+			}
+
+			//Every reference to garbage comes from other garbage, so no one else can reach it anymore. Weak_Ptrs see it as collecting.
+			for (auto counter : garbage)
+				counter->Expire();
+			for (auto counter : garbage)
+			{
+				Shared_Ptr_Container::Unregister(counter, false);
+				counter->ReleaseWeak();
+			}
+			return garbage.size();
+		}
+
+		/*
+		* Number of buffered possible cycle roots.
+		*/
+		static size_t Candidates()
+		{
+			std::lock_guard<std::mutex> mLock(collectorMutex);
+			return roots.size();
+		}
+	};
+
+	inline void Shared_Ptr_Container::RemoveReference(IShared_Ref_Counter* Counter)
+	{
+		if (!Counter)
+			return;
+		auto last = Counter->Traceable() ? Cycle_Collector::Release(Counter) : Counter->Release();
+		if (last && Unregister(Counter, true))
+		{
+			Counter->Expire();
+			Counter->ReleaseWeak();
+		}
+	}
+
+	inline bool Shared_Ptr_Container::TryRetain(IShared_Ref_Counter* Counter)
+	{
+		return Counter->Traceable() ? Cycle_Collector::TryRetain(Counter) : Counter->TryRetain();
+	}
+
+	inline bool Shared_Ptr_Container::Expired(IShared_Ref_Counter* Counter)
+	{
+		return Counter->Traceable() ? Cycle_Collector::Expired(Counter) : Counter->Dead();
+	}
+
+	template <typename T>
+	class Shared_Ptr
+	{
+		template <typename> friend class Shared_Ptr;
+		template <typename> friend struct Shared_Inplace_Counter;
+		template <typename, typename> friend struct Shared_Deleter_Counter;
+		friend class Cycle_Tracer;
+		template <typename> friend class Borrowed_Ptr;
+		template <typename> friend class Weak_Ptr;
+
+		T* _ptr = nullptr;
+		IShared_Ref_Counter* _counter = nullptr;
+
+		[[nodiscard]] Shared_Ptr(T* Ptr, IShared_Ref_Counter* Counter) noexcept : _ptr(Ptr), _counter(Counter) //Adopts a reference already counted.
+		{
+		}
+
+	public:
+
+		[[nodiscard]] Shared_Ptr(std::nullptr_t = nullptr) //Empty pointer.
+		{
+		}
+
+		[[nodiscard]] Shared_Ptr(T* Ptr) : _ptr(Ptr)
+		{
+			_counter = Shared_Ptr_Container::AddNewReference(Ptr);
+		}
+
+		Shared_Ptr(const Shared_Ptr& Ref) noexcept
+		{
+			_ptr = Ref._ptr;
+			_counter = Ref._counter;
+			if (_counter)
+				++*_counter;
+		}
+
+		[[nodiscard]] Shared_Ptr(Shared_Ptr&& Rvr) noexcept //Moves never touch the count.
+		{
+			_ptr = Rvr._ptr;
+			_counter = Rvr._counter;
+			Rvr._ptr = nullptr;
+			Rvr._counter = nullptr;
+		}
+
+		template <typename T1, enable_if_t<is_convertible_v<T1*, T*>, bool> = false>
+		[[nodiscard]] Shared_Ptr(const Shared_Ptr<T1>& Ref) noexcept
+		{
+			_ptr = Ref._ptr;
+			_counter = Ref._counter;
+			if (_counter)
+				++*_counter;
+		}
+
+		template <typename T1, enable_if_t<is_convertible_v<T1*, T*>, bool> = false>
+		[[nodiscard]] Shared_Ptr(Shared_Ptr<T1>&& Rvr) noexcept
+		{
+			_ptr = Rvr._ptr;
+			_counter = Rvr._counter;
+			Rvr._ptr = nullptr;
+			Rvr._counter = nullptr;
+		}
+
+		/*
+		* Shares Owner's ownership while pointing to Ptr, usually Owner's object seen as another type or one of its members.
+		*/
+		template <typename T1>
+		[[nodiscard]] Shared_Ptr(const Shared_Ptr<T1>& Owner, T* Ptr) noexcept : _ptr(Ptr), _counter(Owner._counter)
+		{
+			if (_counter)
+				++*_counter;
+		}
+
+		template <typename T1>
+		[[nodiscard]] Shared_Ptr(Shared_Ptr<T1>&& Owner, T* Ptr) noexcept : _ptr(Ptr), _counter(Owner._counter)
+		{
+			Owner._ptr = nullptr;
+			Owner._counter = nullptr;
+		}
+
+		~Shared_Ptr()
+		{
+			Shared_Ptr_Container::RemoveReference(_counter);
+		}
+
+		Shared_Ptr& operator =(const Shared_Ptr& Ref) noexcept
+		{
+			Shared_Ptr(Ref).Swap(*this);
+			return *this;
+		}
+
+		Shared_Ptr& operator =(Shared_Ptr&& Rvr) noexcept
+		{
+			Shared_Ptr(Move(Rvr)).Swap(*this);
+			return *this;
+		}
+
+		template <typename T1, enable_if_t<is_convertible_v<T1*, T*>, bool> = false>
+		Shared_Ptr& operator =(const Shared_Ptr<T1>& Ref) noexcept
+		{
+			Shared_Ptr(Ref).Swap(*this);
+			return *this;
+		}
+
+		template <typename T1, enable_if_t<is_convertible_v<T1*, T*>, bool> = false>
+		Shared_Ptr& operator =(Shared_Ptr<T1>&& Rvr) noexcept
+		{
+			Shared_Ptr(Move(Rvr)).Swap(*this);
+			return *this;
+		}
+
+		Shared_Ptr& operator =(std::nullptr_t) noexcept
+		{
+			Shared_Ptr().Swap(*this);
+			return *this;
+		}
+
+		void Swap(Shared_Ptr& Ref) noexcept
+		{
+			auto ptr = _ptr;
+			auto counter = _counter;
+			_ptr = Ref._ptr;
+			_counter = Ref._counter;
+			Ref._ptr = ptr;
+			Ref._counter = counter;
+		}
+
+		void Reset(T* Ptr = nullptr)
+		{
+			auto counter = Shared_Ptr_Container::AddNewReference(Ptr);
+			Shared_Ptr_Container::RemoveReference(_counter);
+
+			_ptr = Ptr;
+			_counter = counter;
+		}
+
+		/*
+		* Number of Shared_Ptrs owning the object. A snapshot while other threads copy or drop it, see Shared_Count_Shards::Count for sharded counts.
+		*/
+		uint32_t UseCount() const noexcept
+		{
+			return _counter ? _counter->Count() : 0;
+		}
+
+		bool Unique() const noexcept
+		{
+			return _counter && _counter->Unique();
+		}
+
+		bool Valid() const noexcept
+		{
+			return _ptr != nullptr;
+		}
+
+		T* Get() const noexcept
+		{
+			return _ptr;
+		}
+
+		T* operator ->() const noexcept
+		{
+			return _ptr;
+		}
+	};
+
+	template <typename T>
+	class Shared_Ptr<T[]>
+	{
+		template <typename, typename> friend struct Shared_Deleter_Counter;
+		template <typename> friend class Weak_Ptr;
+
+		T* _ptr = nullptr;
+		size_t size = 0;
+		IShared_Ref_Counter* _counter = nullptr;
+
+		[[nodiscard]] Shared_Ptr(T* Ptr, size_t Size, IShared_Ref_Counter* Counter) noexcept : _ptr(Ptr), size(Size), _counter(Counter) //Adopts a reference already counted.
+		{
+		}
+
+	public:
+
+		[[nodiscard]] Shared_Ptr(std::nullptr_t = nullptr) //Empty pointer.
+		{
+		}
+
+		[[nodiscard]] Shared_Ptr(T* Ptr, size_t Size) : _ptr(Ptr), size(Size)
+		{
+			_counter = Shared_Ptr_Container::AddNewReference(Ptr, true);
+		}
+
+		Shared_Ptr(const Shared_Ptr& Ref) noexcept
+		{
+			_ptr = Ref._ptr;
+			size = Ref.Size();
+			_counter = Ref._counter;
+			if (_counter)
+				++*_counter;
+		}
+
+		[[nodiscard]] Shared_Ptr(Shared_Ptr&& Rvr) noexcept
+		{
+			_ptr = Rvr._ptr;
+			size = Rvr.Size();
+			_counter = Rvr._counter;
+			Rvr._ptr = nullptr;
+			Rvr.size = 0;
+			Rvr._counter = nullptr;
+		}
+
+		~Shared_Ptr()
+		{
+			Shared_Ptr_Container::RemoveReference(_counter);
+		}
+
+		Shared_Ptr& operator =(const Shared_Ptr& Ref) noexcept
+		{
+			Shared_Ptr(Ref).Swap(*this);
+			return *this;
+		}
+
+		Shared_Ptr& operator =(Shared_Ptr&& Rvr) noexcept
+		{
+			Shared_Ptr(Move(Rvr)).Swap(*this);
+			return *this;
+		}
+
+		Shared_Ptr& operator =(std::nullptr_t) noexcept
+		{
+			Shared_Ptr().Swap(*this);
+			return *this;
+		}
+
+		void Swap(Shared_Ptr& Ref) noexcept
+		{
+			auto ptr = _ptr;
+			auto _size = size;
+			auto counter = _counter;
+			_ptr = Ref._ptr;
+			size = Ref.size;
+			_counter = Ref._counter;
+			Ref._ptr = ptr;
+			Ref.size = _size;
+			Ref._counter = counter;
+		}
+
+		void Reset(T* Ptr, size_t Size)
+		{
+			auto counter = Shared_Ptr_Container::AddNewReference(Ptr, true);
+			Shared_Ptr_Container::RemoveReference(_counter);
+
+			_ptr = Ptr;
+			size = Size;
+			_counter = counter;
+		}
+
+		void Reset(T* Ptr = nullptr) //Unable to resolve size
+		{
+			Reset(Ptr, 0);
+		}
+
+		uint32_t UseCount() const noexcept
+		{
+			return _counter ? _counter->Count() : 0;
 		}
 
-		T* Get() const
+		bool Unique() const noexcept
+		{
+			return _counter && _counter->Unique();
+		}
+
+		bool Valid() const noexcept
+		{
+			return _ptr != nullptr;
+		}
+
+		size_t Size() const noexcept
+		{
+			return size;
+		}
+
+		T* Get() const noexcept
 		{
 			return _ptr;
 		}
@@ -518,10 +1489,7 @@ namespace ACBYTES
 		template <size_t ArrSize>
 		void Fill(T(&Array)[ArrSize]) const
 		{
-			for (size_t i = 0; i < ArrSize > size ? size : ArrSize; i++)
-			{
-				Array[i] = *(_ptr + i);
-			}
+			Bulk_Copy(Array, static_cast<const T*>(_ptr), ArrSize < size ? ArrSize : size);
 		}
 
 		T& operator [](size_t Index)
@@ -530,6 +1498,40 @@ namespace ACBYTES
 		}
 	};
 
+	template <typename T>
+	template <Shared_Count Mode, typename... ArgT>
+	Shared_Ptr<T> Shared_Inplace_Counter<T>::Create(ArgT&&... Arguments)
+	{
+		auto counter = new Shared_Inplace_Counter(Mode, Forward<ArgT>(Arguments)...);
+		Shared_Ptr_Container::AddNewCounter(counter);
+		return Shared_Ptr<T>(counter->Get(), counter);
+	}
+
+	template <typename T, typename Deleter>
+	Shared_Ptr<T> Shared_Deleter_Counter<T, Deleter>::Share(Unique_Ptr<T, Deleter>&& Unique)
+	{
+		auto ptr = Unique.Get();
+		if (!ptr)
+			return Shared_Ptr<T>();
+		auto counter = new Shared_Deleter_Counter(ptr, Move(Unique.GetDeleter()), has_trace_member<T>::value);
+		Unique.Release();
+		Shared_Ptr_Container::AddNewCounter(counter);
+		return Shared_Ptr<T>(ptr, counter);
+	}
+
+	template <typename T, typename Deleter>
+	Shared_Ptr<T[]> Shared_Deleter_Counter<T, Deleter>::Share(Unique_Ptr<T[], Deleter>&& Unique)
+	{
+		auto ptr = Unique.Get();
+		auto size = Unique.Size();
+		if (!ptr)
+			return Shared_Ptr<T[]>();
+		auto counter = new Shared_Deleter_Counter(ptr, Move(Unique.GetDeleter()), false);
+		Unique.Release();
+		Shared_Ptr_Container::AddNewCounter(counter);
+		return Shared_Ptr<T[]>(ptr, size, counter);
+	}
+
 	/*
 	* Makes shared pointer pointing to an array with the size passed.
 	*/
@@ -560,70 +1562,250 @@ namespace ACBYTES
 	* Makes shared pointer pointing to an object of type T.
 	*/
 	template <typename T, typename... ArgT, enable_if_t<!is_array_v<T>, bool> = false>
-	[[nodiscard]] auto Make_Shared(ArgT... Arguments) -> Shared_Ptr<T>
+	[[nodiscard]] auto Make_Shared(ArgT&&... Arguments) -> Shared_Ptr<T>
 	{
-		auto _init = new T(Forward<ArgT>(Arguments)...);
-		return Shared_Ptr<T>(_init);
+		return Shared_Inplace_Counter<T>::Create(Forward<ArgT>(Arguments)...); //Object and counter share one allocation.
+	}
+
+	/*
+	* Makes shared pointer pointing to an object of type T, counted as Mode says:
+	* auto config = Make_Shared<Config, Shared_Count::SHARDED>(path);
+	*/
+	template <typename T, Shared_Count Mode, typename... ArgT, enable_if_t<!is_array_v<T>, bool> = false>
+	[[nodiscard]] auto Make_Shared(ArgT&&... Arguments) -> Shared_Ptr<T>
+	{
+		return Shared_Inplace_Counter<T>::template Create<Mode>(Forward<ArgT>(Arguments)...);
+	}
+
+	/*
+	* Moves a unique pointer's object into shared ownership. The last Shared_Ptr destroys it with the Unique_Ptr's deleter.
+	*/
+	template <typename T, typename Deleter>
+	[[nodiscard]] auto To_Shared(Unique_Ptr<T, Deleter>&& Unique) -> Shared_Ptr<T>
+	{
+		return Shared_Deleter_Counter<T, Deleter>::Share(Move(Unique));
+	}
+
+	template <typename T, typename Deleter>
+	[[nodiscard]] auto To_Shared(Unique_Ptr<T[], Deleter>&& Unique) -> Shared_Ptr<T[]>
+	{
+		return Shared_Deleter_Counter<T, Deleter>::Share(Move(Unique));
 	}
 #pragma endregion Shared_Ptr
 
+#pragma region Borrowed_Ptr
+	/*
+	* Non-owning view of a Shared_Ptr's object for parameters and locals: making, copying and dropping one doesn't touch the count.
+	* The owner must outlive it; debug builds count live borrows per object and assert when the object's counter goes first.
+	* Share turns it back into a Shared_Ptr in O(1) when the callee needs to keep the object:
+	* void Observe(Borrowed_Ptr<Widget> Target) { if (Target->Interesting()) _kept.push_back(Target.Share()); }
+	* @param T [Pointed-to type].
+	*/
+	template <typename T>
+	class Borrowed_Ptr
+	{
+		static_assert(!is_array_v<T>, "Borrowed_Ptr views single objects.");
+
+		template <typename> friend class Borrowed_Ptr;
+
+		T* _ptr = nullptr;
+		IShared_Ref_Counter* _counter = nullptr;
+
+		void Borrow() noexcept
+		{
+#if ACBYTES_DEBUG
+			if (_counter)
+				_counter->Borrow();
+#endif
+		}
+
+	public:
+		[[nodiscard]] Borrowed_Ptr(std::nullptr_t = nullptr) noexcept //Empty pointer.
+		{
+		}
+
+		template <typename T1, enable_if_t<is_convertible_v<T1*, T*>, bool> = false>
+		[[nodiscard]] Borrowed_Ptr(const Shared_Ptr<T1>& Owner) noexcept : _ptr(Owner._ptr), _counter(Owner._counter)
+		{
+			Borrow();
+		}
+
+		[[nodiscard]] Borrowed_Ptr(const Borrowed_Ptr& Ref) noexcept : _ptr(Ref._ptr), _counter(Ref._counter)
+		{
+			Borrow();
+		}
+
+		template <typename T1, enable_if_t<is_convertible_v<T1*, T*>, bool> = false>
+		[[nodiscard]] Borrowed_Ptr(const Borrowed_Ptr<T1>& Ref) noexcept : _ptr(Ref._ptr), _counter(Ref._counter)
+		{
+			Borrow();
+		}
+
+		~Borrowed_Ptr()
+		{
+			Reset();
+		}
+
+		Borrowed_Ptr& operator =(const Borrowed_Ptr& Ref) noexcept
+		{
+			Borrowed_Ptr(Ref).Swap(*this);
+			return *this;
+		}
+
+		void Swap(Borrowed_Ptr& Ref) noexcept
+		{
+			auto ptr = _ptr;
+			auto counter = _counter;
+			_ptr = Ref._ptr;
+			_counter = Ref._counter;
+			Ref._ptr = ptr;
+			Ref._counter = counter;
+		}
+
+		void Reset() noexcept
+		{
+#if ACBYTES_DEBUG
+			if (_counter)
+				_counter->Return();
+#endif
+			_ptr = nullptr;
+			_counter = nullptr;
+		}
+
+		/*
+		* Shares ownership of the borrowed object. Only counts a reference, the registry isn't searched.
+		*/
+		[[nodiscard]] Shared_Ptr<T> Share() const noexcept
+		{
+			if (!_counter)
+				return Shared_Ptr<T>();
+			++*_counter;
+			return Shared_Ptr<T>(_ptr, _counter);
+		}
+
+		bool Valid() const noexcept
+		{
+			return _ptr != nullptr;
+		}
+
+		T* Get() const noexcept
+		{
+			return _ptr;
+		}
+
+		T* operator ->() const noexcept
+		{
+			return _ptr;
+		}
+	};
+#pragma endregion Borrowed_Ptr
+
 #pragma region Weak_Ptr
+	/*
+	* Non-owning reference to a Shared_Ptr's object that can tell whether the object is gone. It keeps the counter alive instead
+	* of the object, so Expired and Lock are O(1) and don't search the registry.
+	* @param T [Pointed-to type].
+	*/
 	template <typename T>
 	class Weak_Ptr
 	{
+		template <typename> friend class Weak_Ptr;
+
 		T* _ptr = nullptr;
+		IShared_Ref_Counter* _counter = nullptr;
 
 	public:
-		[[nodiscard]] Weak_Ptr() //Empty pointer
+		[[nodiscard]] Weak_Ptr(std::nullptr_t = nullptr) noexcept //Empty pointer
 		{
 		}
 
-		[[nodiscard]] Weak_Ptr(const Shared_Ptr<T>& Ref)
+		template <typename T1, enable_if_t<is_convertible_v<T1*, T*>, bool> = false>
+		[[nodiscard]] Weak_Ptr(const Shared_Ptr<T1>& Ref) noexcept : _ptr(Ref._ptr), _counter(Ref._counter)
 		{
-			_ptr = Ref.Get();
+			if (_counter)
+				_counter->AddWeak();
 		}
 
-		template <typename T1, enable_if_t<is_base_of_v<T, T1>, bool> = false>
-		[[nodiscard]] Weak_Ptr(const Shared_Ptr<T1>& Ref)
+		template <typename T1, enable_if_t<is_convertible_v<T1*, T*>, bool> = false>
+		[[nodiscard]] Weak_Ptr(const Weak_Ptr<T1>& Ref) noexcept : _ptr(Ref._ptr), _counter(Ref._counter)
 		{
-			_ptr = (T*)Ref.Get();
+			if (_counter)
+				_counter->AddWeak();
 		}
 
-		template <typename T1, enable_if_t<is_base_of_v<T, T1>, bool> = false>
-		[[nodiscard]] Weak_Ptr(const Weak_Ptr<T1>& Ref)
+		[[nodiscard]] Weak_Ptr(const Weak_Ptr& Ref) noexcept : _ptr(Ref._ptr), _counter(Ref._counter)
 		{
-			_ptr = (T*)Ref._ptr;
+			if (_counter)
+				_counter->AddWeak();
 		}
 
-		[[nodiscard]] Weak_Ptr(Weak_Ptr&& Rvr) noexcept
+		[[nodiscard]] Weak_Ptr(Weak_Ptr&& Rvr) noexcept : _ptr(Rvr._ptr), _counter(Rvr._counter)
 		{
-			_ptr = Rvr._ptr;
 			Rvr._ptr = nullptr;
+			Rvr._counter = nullptr;
+		}
+
+		~Weak_Ptr()
+		{
+			if (_counter)
+				_counter->ReleaseWeak();
+		}
+
+		Weak_Ptr& operator =(const Weak_Ptr& Ref) noexcept
+		{
+			Weak_Ptr(Ref).Swap(*this);
+			return *this;
+		}
+
+		Weak_Ptr& operator =(Weak_Ptr&& Rvr) noexcept
+		{
+			Weak_Ptr(Move(Rvr)).Swap(*this);
+			return *this;
+		}
+
+		Weak_Ptr& operator =(std::nullptr_t) noexcept
+		{
+			Reset();
+			return *this;
 		}
 
+		/*
+		* Shares the object, empty if it's gone.
+		*/
 		[[nodiscard]] Shared_Ptr<T> Lock() const
 		{
-			return _ptr ? Shared_Ptr<T>(_ptr) : Shared_Ptr<T>();
+			return _counter && Shared_Ptr_Container::TryRetain(_counter) ? Shared_Ptr<T>(_ptr, _counter) : Shared_Ptr<T>();
+		}
+
+		/*
+		* Whether the object is gone. Another thread may release it right after a false answer; Lock tells for certain.
+		*/
+		bool Expired() const
+		{
+			return !_counter || Shared_Ptr_Container::Expired(_counter);
 		}
 
-		void Swap(Weak_Ptr& Ref)
+		void Swap(Weak_Ptr& Ref) noexcept
 		{
 			auto ptr = _ptr;
+			auto counter = _counter;
 			_ptr = Ref._ptr;
+			_counter = Ref._counter;
 			Ref._ptr = ptr;
+			Ref._counter = counter;
 		}
 
-		void Reset()
+		void Reset() noexcept
 		{
-			_ptr = nullptr;
+			Weak_Ptr().Swap(*this);
 		}
 
-		T* Get() const
+		T* Get() const noexcept
 		{
 			return _ptr;
 		}
 
-		T* operator ->()
+		T* operator ->() const noexcept
 		{
 			return _ptr;
 		}
@@ -633,65 +1815,108 @@ namespace ACBYTES
 	class Weak_Ptr<T[]>
 	{
 		T* _ptr = nullptr;
-		size_t size;
+		size_t size = 0;
+		IShared_Ref_Counter* _counter = nullptr;
 
 	public:
-		[[nodiscard]] Weak_Ptr() //Empty pointer
+		[[nodiscard]] Weak_Ptr(std::nullptr_t = nullptr) noexcept //Empty pointer
 		{
 		}
 
-		[[nodiscard]] Weak_Ptr(const Shared_Ptr<T[]>& Ref)
+		[[nodiscard]] Weak_Ptr(const Shared_Ptr<T[]>& Ref) noexcept : _ptr(Ref._ptr), size(Ref.size), _counter(Ref._counter)
 		{
-			_ptr = Ref.Get();
-			size = Ref.Size();
+			if (_counter)
+				_counter->AddWeak();
 		}
 
-		[[nodiscard]] Weak_Ptr(Weak_Ptr&& Rvr) noexcept
+		[[nodiscard]] Weak_Ptr(const Weak_Ptr& Ref) noexcept : _ptr(Ref._ptr), size(Ref.size), _counter(Ref._counter)
+		{
+			if (_counter)
+				_counter->AddWeak();
+		}
+
+		[[nodiscard]] Weak_Ptr(Weak_Ptr&& Rvr) noexcept : _ptr(Rvr._ptr), size(Rvr.size), _counter(Rvr._counter)
 		{
-			_ptr = Rvr._ptr;
-			size = Rvr.size;
 			Rvr._ptr = nullptr;
 			Rvr.size = 0;
+			Rvr._counter = nullptr;
+		}
+
+		~Weak_Ptr()
+		{
+			if (_counter)
+				_counter->ReleaseWeak();
+		}
+
+		Weak_Ptr& operator =(const Weak_Ptr& Ref) noexcept
+		{
+			Weak_Ptr(Ref).Swap(*this);
+			return *this;
+		}
+
+		Weak_Ptr& operator =(Weak_Ptr&& Rvr) noexcept
+		{
+			Weak_Ptr(Move(Rvr)).Swap(*this);
+			return *this;
+		}
+
+		Weak_Ptr& operator =(std::nullptr_t) noexcept
+		{
+			Reset();
+			return *this;
 		}
 
+		/*
+		* Shares the array, empty if it's gone.
+		*/
 		[[nodiscard]] Shared_Ptr<T[]> Lock() const
 		{
-			return _ptr ? Shared_Ptr<T[]>(_ptr, size) : Shared_Ptr<T[]>();
+			return _counter && Shared_Ptr_Container::TryRetain(_counter) ? Shared_Ptr<T[]>(_ptr, size, _counter) : Shared_Ptr<T[]>();
+		}
+
+		/*
+		* Whether the array is gone. Another thread may release it right after a false answer; Lock tells for certain.
+		*/
+		bool Expired() const
+		{
+			return !_counter || Shared_Ptr_Container::Expired(_counter);
 		}
 
-		void Swap(Weak_Ptr& Ref)
+		void Swap(Weak_Ptr& Ref) noexcept
 		{
 			auto ptr = _ptr;
 			auto _size = size;
+			auto counter = _counter;
 			_ptr = Ref._ptr;
 			size = Ref.size;
+			_counter = Ref._counter;
 			Ref._ptr = ptr;
 			Ref.size = _size;
+			Ref._counter = counter;
 		}
 
-		void Reset()
+		void Reset() noexcept
 		{
-			_ptr = nullptr;
-			size = size_t();
+			Weak_Ptr().Swap(*this);
 		}
 
-		T* Get() const
+		T* Get() const noexcept
 		{
 			return _ptr;
 		}
 
-		size_t Size() const
+		size_t Size() const noexcept
 		{
 			return size;
 		}
 
+		/*
+		* Copies up to ArrSize elements into Array. Only valid while the array is alive, see Lock.
+		*/
 		template <size_t ArrSize>
 		void Fill(T(&Array)[ArrSize])
 		{
-			for (size_t i = 0; i < ArrSize > size ? size : ArrSize; i++)
-			{
-				Array[i] = *(_ptr + i);
-			}
+			Bulk_Copy(Array, static_cast<const T*>(_ptr), ArrSize < size ? ArrSize : size);
 		}
 
 		T& operator [](size_t Index)
@@ -700,6 +1925,151 @@ namespace ACBYTES
 		}
 	};
 #pragma endregion Weak_Ptr
+
+#pragma region Pointer_Comparison
+	template <typename T>
+	struct is_smart_pointer
+	{
+		static constexpr bool value = false;
+	};
+
+	template <typename T, typename Deleter>
+	struct is_smart_pointer<Unique_Ptr<T, Deleter>>
+	{
+		static constexpr bool value = true;
+	};
+
+	template <typename T>
+	struct is_smart_pointer<Shared_Ptr<T>>
+	{
+		static constexpr bool value = true;
+	};
+
+	template <typename T>
+	struct is_smart_pointer<Weak_Ptr<T>>
+	{
+		static constexpr bool value = true;
+	};
+
+	template <typename T>
+	static constexpr bool is_smart_pointer_v = is_smart_pointer<T>::value;
+
+	/*
+	* Smart pointers compare by address, across kinds and along class hierarchies like raw pointers do.
+	*/
+	template <typename Ptr, typename Ptr1, enable_if_t<is_smart_pointer_v<Ptr> && is_smart_pointer_v<Ptr1>, bool> = false>
+	bool operator ==(const Ptr& Left, const Ptr1& Right) noexcept
+	{
+		return Left.Get() == Right.Get();
+	}
+
+	template <typename Ptr, typename Ptr1, enable_if_t<is_smart_pointer_v<Ptr> && is_smart_pointer_v<Ptr1>, bool> = false>
+	bool operator !=(const Ptr& Left, const Ptr1& Right) noexcept
+	{
+		return Left.Get() != Right.Get();
+	}
+
+	//Total order even between unrelated objects, through std::less.
+	template <typename Ptr, typename Ptr1, enable_if_t<is_smart_pointer_v<Ptr> && is_smart_pointer_v<Ptr1>, bool> = false>
+	bool operator <(const Ptr& Left, const Ptr1& Right) noexcept
+	{
+		using common = decltype(true ? Left.Get() : Right.Get());
+		return std::less<common>()(Left.Get(), Right.Get());
+	}
+
+	template <typename Ptr, typename Ptr1, enable_if_t<is_smart_pointer_v<Ptr> && is_smart_pointer_v<Ptr1>, bool> = false>
+	bool operator >(const Ptr& Left, const Ptr1& Right) noexcept
+	{
+		return Right < Left;
+	}
+
+	template <typename Ptr, typename Ptr1, enable_if_t<is_smart_pointer_v<Ptr> && is_smart_pointer_v<Ptr1>, bool> = false>
+	bool operator <=(const Ptr& Left, const Ptr1& Right) noexcept
+	{
+		return !(Right < Left);
+	}
+
+	template <typename Ptr, typename Ptr1, enable_if_t<is_smart_pointer_v<Ptr> && is_smart_pointer_v<Ptr1>, bool> = false>
+	bool operator >=(const Ptr& Left, const Ptr1& Right) noexcept
+	{
+		return !(Left < Right);
+	}
+
+	template <typename Ptr, enable_if_t<is_smart_pointer_v<Ptr>, bool> = false>
+	bool operator ==(const Ptr& Left, std::nullptr_t) noexcept
+	{
+		return Left.Get() == nullptr;
+	}
+
+	template <typename Ptr, enable_if_t<is_smart_pointer_v<Ptr>, bool> = false>
+	bool operator ==(std::nullptr_t, const Ptr& Right) noexcept
+	{
+		return Right.Get() == nullptr;
+	}
+
+	template <typename Ptr, enable_if_t<is_smart_pointer_v<Ptr>, bool> = false>
+	bool operator !=(const Ptr& Left, std::nullptr_t) noexcept
+	{
+		return Left.Get() != nullptr;
+	}
+
+	template <typename Ptr, enable_if_t<is_smart_pointer_v<Ptr>, bool> = false>
+	bool operator !=(std::nullptr_t, const Ptr& Right) noexcept
+	{
+		return Right.Get() != nullptr;
+	}
+
+	/*
+	* Hashes the address, consistent with operator ==.
+	*/
+	template <typename Ptr>
+	struct Pointer_Hash
+	{
+		size_t operator()(const Ptr& Pointer) const noexcept
+		{
+			return std::hash<decltype(Pointer.Get())>()(Pointer.Get());
+		}
+	};
+#pragma endregion Pointer_Comparison
+
+#pragma region Relocation
+	//Smart pointers hold no pointers into themselves, only the deleter decides for Unique_Ptr.
+	template <typename T, typename Deleter>
+	struct is_trivially_relocatable<Unique_Ptr<T, Deleter>>
+	{
+		static constexpr bool value = is_trivially_relocatable<Deleter>::value;
+	};
+
+	template <typename T>
+	struct is_trivially_relocatable<Shared_Ptr<T>>
+	{
+		static constexpr bool value = true;
+	};
+
+	template <typename T>
+	struct is_trivially_relocatable<Weak_Ptr<T>>
+	{
+		static constexpr bool value = true;
+	};
+#pragma endregion Relocation
+}
+
+namespace std
+{
+	template <typename T, typename Deleter>
+	struct hash<ACBYTES::Unique_Ptr<T, Deleter>> : ACBYTES::Pointer_Hash<ACBYTES::Unique_Ptr<T, Deleter>>
+	{
+	};
+
+	template <typename T>
+	struct hash<ACBYTES::Shared_Ptr<T>> : ACBYTES::Pointer_Hash<ACBYTES::Shared_Ptr<T>>
+	{
+	};
+
+	template <typename T>
+	struct hash<ACBYTES::Weak_Ptr<T>> : ACBYTES::Pointer_Hash<ACBYTES::Weak_Ptr<T>>
+	{
+	};
 }
 
 #endif SMART_POINTERS_H
\ No newline at end of file
@@ -0,0 +1,366 @@
+#ifndef CONCURRENT_HASH_MAP_H
+#define CONCURRENT_HASH_MAP_H
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include "Definitions.h"
+#include "Epoch.h"
+#include "Smart_Pointers.h"
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Concurrent_Hash_Map
+	/*
+	* Hash map from K to Shared_Ptr<V> for read-mostly sharing between threads.
+	* Find never locks: nodes are immutable once published, so a reader walks a chain under an Epoch::Guard and copies the value's
+	* Shared_Ptr. Writers lock one of a fixed set of stripes, chosen by the hash's low bits, and replace nodes instead of changing them;
+	* unlinked nodes are retired to Epoch.
+	* Growing is incremental: a larger table is linked behind the current one and every write first copies the bucket it touches and
+	* a few others, leaving a MOVED marker readers follow into the new table.
+	* @param K [Key type, copied when the table grows].
+	* @param V [Pointed-to value type].
+	* @param Hash [Hasher of K].
+	* @param Key_Equal [Equality of K].
+	*/
+	template <typename K, typename V, typename Hash = std::hash<K>, typename Key_Equal = std::equal_to<K>>
+	class Concurrent_Hash_Map
+	{
+		static constexpr size_t cache_line_size = 64;
+		static constexpr size_t max_load_factor = 2;
+		static constexpr size_t migration_batch = 4;
+
+		struct Node
+		{
+			size_t hash;
+			K key;
+			Shared_Ptr<V> value;
+			std::atomic<Node*> next;
+		};
+
+		struct Table
+		{
+			size_t mask;
+			std::atomic<Node*>* buckets;
+			std::atomic<Table*> next{ nullptr };
+			std::atomic<size_t> migrationCursor{ 0 };
+			std::atomic<size_t> migrated{ 0 };
+
+			[[nodiscard]] explicit Table(size_t Size) : mask(Size - 1), buckets(new std::atomic<Node*>[Size]())
+			{
+			}
+
+			~Table()
+			{
+				delete[] buckets;
+			}
+		};
+
+		struct alignas(cache_line_size) Stripe
+		{
+			std::mutex lock;
+			std::atomic<size_t> size{ 0 };
+		};
+
+		/*
+		* What a write unlinked, retired once its stripe is unlocked: retired nodes may hold the last reference to a value whose
+		* destructor uses this map.
+		*/
+		struct Retirements
+		{
+			Node* node = nullptr;
+			Node* chain = nullptr;
+			Table* table = nullptr;
+
+			~Retirements()
+			{
+				if (node)
+					Epoch::Retire(node);
+				if (chain)
+					Epoch::Retire(chain, DeleteChain);
+				if (table)
+					Epoch::Retire(table);
+			}
+		};
+
+		std::atomic<Table*> _table;
+		Stripe* _stripes;
+		size_t _stripeMask;
+		NO_UNIQUE_ADDRESS Hash _hash;
+		NO_UNIQUE_ADDRESS Key_Equal _equal;
+
+		static Node* Moved() noexcept
+		{
+			static char moved;
+			return reinterpret_cast<Node*>(&moved);
+		}
+
+		static size_t RoundSize(size_t Size) noexcept
+		{
+			size_t size = 1;
+			while (size < Size)
+				size <<= 1;
+			return size;
+		}
+
+		static void DeleteChain(void* Head)
+		{
+			for (auto node = static_cast<Node*>(Head); node;)
+			{
+				auto next = node->next.load(std::memory_order_relaxed);
+				delete node;
+				node = next;
+			}
+		}
+
+		Stripe& StripeOf(size_t KeyHash) const noexcept
+		{
+			return _stripes[KeyHash & _stripeMask];
+		}
+
+		/*
+		* Copies bucket Index of Old into New. The caller holds the bucket's stripe, which also guards both buckets it splits into.
+		*/
+		void Migrate(Table* Old, Table* New, size_t Index, Retirements& Retired)
+		{
+			auto& bucket = Old->buckets[Index];
+			auto head = bucket.load(std::memory_order_relaxed);
+			if (head == Moved())
+				return;
+			for (auto node = head; node; node = node->next.load(std::memory_order_relaxed))
+			{
+				auto& target = New->buckets[node->hash & New->mask];
+				auto copy = new Node{ node->hash, node->key, node->value, { target.load(std::memory_order_relaxed) } };
+				target.store(copy, std::memory_order_release);
+			}
+			bucket.store(Moved(), std::memory_order_release);
+			Retired.chain = head;
+
+			if (Old->migrated.fetch_add(1, std::memory_order_acq_rel) == Old->mask)
+			{
+				_table.store(New, std::memory_order_release);
+				Retired.table = Old;
+			}
+		}
+
+		/*
+		* Copies a few buckets of a table being replaced, each under its own stripe. Called without holding a stripe.
+		*/
+		void HelpMigrate()
+		{
+			auto table = _table.load(std::memory_order_acquire);
+			auto next = table->next.load(std::memory_order_acquire);
+			if (!next)
+				return;
+			for (size_t i = 0; i < migration_batch; i++)
+			{
+				auto index = table->migrationCursor.fetch_add(1, std::memory_order_relaxed);
+				if (index > table->mask)
+					return;
+				Retirements retired;
+				std::lock_guard<std::mutex> mLock(StripeOf(index).lock);
+				Migrate(table, next, index, retired);
+			}
+		}
+
+		/*
+		* Links a table twice Current's size behind it, unless Current is still being filled from an older table or already grows.
+		*/
+		void Grow(Table* Current)
+		{
+			if (_table.load(std::memory_order_acquire) != Current || Current->next.load(std::memory_order_relaxed))
+				return;
+			auto next = new Table((Current->mask + 1) * 2);
+			Table* expected = nullptr;
+			if (!Current->next.compare_exchange_strong(expected, next, std::memory_order_acq_rel))
+				delete next;
+		}
+
+		/*
+		* Locks KeyHash's stripe, brings its bucket into the newest table and runs Write on that bucket.
+		* Write returns the change in size, Modify whether there was one.
+		*/
+		template <typename Operation>
+		bool Modify(size_t KeyHash, Operation Write)
+		{
+			Epoch::Guard guard;
+			HelpMigrate();
+
+			Retirements retired;
+			bool changed;
+			bool grow;
+			Table* table;
+			{
+				auto& stripe = StripeOf(KeyHash);
+				std::lock_guard<std::mutex> mLock(stripe.lock);
+				table = _table.load(std::memory_order_acquire);
+				for (auto next = table->next.load(std::memory_order_acquire); next; next = table->next.load(std::memory_order_acquire))
+				{
+					Migrate(table, next, KeyHash & table->mask, retired);
+					table = next;
+				}
+
+				auto delta = Write(table->buckets[KeyHash & table->mask], retired);
+				changed = delta != 0;
+				auto size = stripe.size.load(std::memory_order_relaxed) + delta;
+				stripe.size.store(size, std::memory_order_relaxed);
+				grow = (size * (_stripeMask + 1)) > (table->mask + 1) * max_load_factor;
+			}
+			if (grow)
+				Grow(table);
+			return changed;
+		}
+
+		/*
+		* The link pointing to Key's node in Bucket, or to the null at its end.
+		*/
+		std::atomic<Node*>* FindLink(std::atomic<Node*>& Bucket, size_t KeyHash, const K& Key) const
+		{
+			auto link = &Bucket;
+			for (auto node = link->load(std::memory_order_relaxed); node; node = link->load(std::memory_order_relaxed))
+			{
+				if (node->hash == KeyHash && _equal(node->key, Key))
+					return link;
+				link = &node->next;
+			}
+			return link;
+		}
+
+	public:
+		/*
+		* @param Buckets [Initial number of buckets, rounded up to a power of two and to at least Stripes].
+		* @param Stripes [Number of write locks, rounded up to a power of two].
+		*/
+		[[nodiscard]] explicit Concurrent_Hash_Map(size_t Buckets = 64, size_t Stripes = 64, const Hash& Hasher = Hash(), const Key_Equal& Equal = Key_Equal())
+			: _hash(Hasher), _equal(Equal)
+		{
+			auto stripes = RoundSize(Stripes);
+			auto buckets = RoundSize(Buckets);
+			_stripes = new Stripe[stripes];
+			_stripeMask = stripes - 1;
+			_table.store(new Table(buckets < stripes ? stripes : buckets), std::memory_order_relaxed);
+		}
+
+		~Concurrent_Hash_Map()
+		{
+			for (auto table = _table.load(std::memory_order_relaxed); table;)
+			{
+				for (size_t i = 0; i <= table->mask; i++)
+				{
+					auto head = table->buckets[i].load(std::memory_order_relaxed);
+					if (head != Moved())
+						DeleteChain(head);
+				}
+				auto next = table->next.load(std::memory_order_relaxed);
+				delete table;
+				table = next;
+			}
+			delete[] _stripes;
+		}
+
+		/*
+		* Returns the value mapped to Key, empty if there is none. Lock-free.
+		*/
+		[[nodiscard]] Shared_Ptr<V> Find(const K& Key) const
+		{
+			auto hash = _hash(Key);
+			Epoch::Guard guard;
+			auto table = _table.load(std::memory_order_acquire);
+			auto node = table->buckets[hash & table->mask].load(std::memory_order_acquire);
+			while (node == Moved())
+			{
+				table = table->next.load(std::memory_order_acquire);
+				node = table->buckets[hash & table->mask].load(std::memory_order_acquire);
+			}
+			for (; node; node = node->next.load(std::memory_order_acquire))
+			{
+				if (node->hash == hash && _equal(node->key, Key))
+					return node->value;
+			}
+			return Shared_Ptr<V>();
+		}
+
+		bool Contains(const K& Key) const
+		{
+			return Find(Key).Valid();
+		}
+
+		/*
+		* Maps Key to Value unless Key is already present. Returns whether it inserted.
+		*/
+		bool Insert(const K& Key, Shared_Ptr<V> Value)
+		{
+			auto hash = _hash(Key);
+			return Modify(hash, [&](std::atomic<Node*>& Bucket, Retirements&) -> size_t
+			{
+				if (FindLink(Bucket, hash, Key)->load(std::memory_order_relaxed))
+					return 0;
+				Bucket.store(new Node{ hash, Key, Move(Value), { Bucket.load(std::memory_order_relaxed) } }, std::memory_order_release);
+				return 1;
+			});
+		}
+
+		/*
+		* Maps Key to Value, replacing any previous value. Returns whether Key was new.
+		*/
+		bool InsertOrAssign(const K& Key, Shared_Ptr<V> Value)
+		{
+			auto hash = _hash(Key);
+			return Modify(hash, [&](std::atomic<Node*>& Bucket, Retirements& Retired) -> size_t
+			{
+				auto link = FindLink(Bucket, hash, Key);
+				auto node = link->load(std::memory_order_relaxed);
+				if (!node)
+				{
+					Bucket.store(new Node{ hash, Key, Move(Value), { Bucket.load(std::memory_order_relaxed) } }, std::memory_order_release);
+					return 1;
+				}
+				link->store(new Node{ hash, Key, Move(Value), { node->next.load(std::memory_order_relaxed) } }, std::memory_order_release);
+				Retired.node = node;
+				return 0;
+			});
+		}
+
+		/*
+		* Removes Key. Returns whether it was present.
+		*/
+		bool Erase(const K& Key)
+		{
+			auto hash = _hash(Key);
+			return Modify(hash, [&](std::atomic<Node*>& Bucket, Retirements& Retired) -> size_t
+			{
+				auto link = FindLink(Bucket, hash, Key);
+				auto node = link->load(std::memory_order_relaxed);
+				if (!node)
+					return 0;
+				link->store(node->next.load(std::memory_order_relaxed), std::memory_order_release);
+				Retired.node = node;
+				return static_cast<size_t>(-1);
+			});
+		}
+
+		//Approximate while other threads write.
+		size_t Size() const noexcept
+		{
+			size_t size = 0;
+			for (size_t i = 0; i <= _stripeMask; i++)
+				size += _stripes[i].size.load(std::memory_order_relaxed);
+			return size;
+		}
+
+		bool Empty() const noexcept
+		{
+			return Size() == 0;
+		}
+
+		Concurrent_Hash_Map(const Concurrent_Hash_Map&) = delete;
+		Concurrent_Hash_Map& operator =(const Concurrent_Hash_Map&) = delete;
+	};
+#pragma endregion Concurrent_Hash_Map
+}
+
+#endif CONCURRENT_HASH_MAP_H
\ No newline at end of file
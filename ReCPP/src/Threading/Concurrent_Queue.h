@@ -0,0 +1,329 @@
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "Smart_Pointers.h"
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Concurrent_Queue
+	enum class Queue_Access
+	{
+		SINGLE,
+		MULTIPLE
+	};
+
+	/*
+	* Bounded lock-free ring buffer handing Unique_Ptr ownership between threads (Vyukov's bounded MPMC queue).
+	* Every slot carries a sequence number and sits on its own cache line; a side declared SINGLE skips the CAS on its index.
+	* Batch Push/Pop claim a whole run of slots with a single atomic operation.
+	* @param T [Pointed-to type].
+	* @param Producers [Whether one or many threads push].
+	* @param Consumers [Whether one or many threads pop].
+	*/
+	template <typename T, Queue_Access Producers = Queue_Access::MULTIPLE, Queue_Access Consumers = Queue_Access::MULTIPLE>
+	class Concurrent_Queue
+	{
+		static_assert(!is_array_v<T>, "Concurrent_Queue transfers single objects.");
+
+		static constexpr size_t cache_line_size = 64;
+
+		struct alignas(cache_line_size) Slot
+		{
+			std::atomic<size_t> sequence;
+			T* item;
+		};
+
+		Slot* _slots;
+		size_t _mask;
+		alignas(cache_line_size) std::atomic<size_t> _enqueuePosition{ 0 };
+		alignas(cache_line_size) std::atomic<size_t> _dequeuePosition{ 0 };
+
+		static size_t RoundCapacity(size_t Capacity) noexcept
+		{
+			size_t capacity = 2;
+			while (capacity < Capacity)
+				capacity <<= 1;
+			return capacity;
+		}
+
+		/*
+		* Claims up to Count consecutive positions whose slots are in the expected state (Offset 0 = free, 1 = filled).
+		*/
+		template <Queue_Access Access>
+		size_t Claim(std::atomic<size_t>& Position, size_t Offset, size_t Count, size_t& Start)
+		{
+			if (Count == 0)
+				return 0; //Nothing to claim, and ready == 0 below would read as a lost race.
+			auto position = Position.load(std::memory_order_relaxed);
+			while (true)
+			{
+				size_t ready = 0;
+				while (ready < Count && _slots[(position + ready) & _mask].sequence.load(std::memory_order_acquire) == position + ready + Offset)
+					ready++;
+
+				if (ready == 0)
+				{
+					auto sequence = _slots[position & _mask].sequence.load(std::memory_order_acquire);
+					if (static_cast<intptr_t>(sequence - (position + Offset)) < 0)
+						return 0; //Full (push) or empty (pop).
+					position = Position.load(std::memory_order_relaxed); //Another thread got this position first.
+					continue;
+				}
+
+				if constexpr (Access == Queue_Access::SINGLE)
+				{
+					Position.store(position + ready, std::memory_order_relaxed);
+					Start = position;
+					return ready;
+				}
+				else
+				{
+					if (Position.compare_exchange_weak(position, position + ready, std::memory_order_relaxed, std::memory_order_relaxed))
+					{
+						Start = position;
+						return ready;
+					}
+				}
+			}
+		}
+
+	public:
+		/*
+		* @param Capacity [Minimum number of items the queue can hold, rounded up to a power of two].
+		*/
+		[[nodiscard]] explicit Concurrent_Queue(size_t Capacity) : _mask(RoundCapacity(Capacity) - 1)
+		{
+			_slots = new Slot[_mask + 1];
+			for (size_t i = 0; i <= _mask; i++)
+			{
+				_slots[i].sequence.store(i, std::memory_order_relaxed);
+				_slots[i].item = nullptr;
+			}
+		}
+
+		~Concurrent_Queue()
+		{
+			while (Pop().Valid())
+			{
+			}
+			delete[] _slots;
+		}
+
+		size_t Capacity() const noexcept
+		{
+			return _mask + 1;
+		}
+
+		//Approximate while other threads push or pop.
+		size_t Size() const noexcept
+		{
+			auto dequeued = _dequeuePosition.load(std::memory_order_relaxed);
+			auto enqueued = _enqueuePosition.load(std::memory_order_relaxed);
+			return enqueued > dequeued ? enqueued - dequeued : 0;
+		}
+
+		/*
+		* Takes ownership of Item if there is room. On failure Item keeps its pointer.
+		*/
+		bool Push(Unique_Ptr<T>&& Item)
+		{
+			size_t start;
+			if (!Claim<Producers>(_enqueuePosition, 0, 1, start))
+				return false;
+			auto& slot = _slots[start & _mask];
+			slot.item = Item.Get();
+			Item.Release();
+			slot.sequence.store(start + 1, std::memory_order_release);
+			return true;
+		}
+
+		/*
+		* Pushes as many of Items as fit with a single claim. Returns how many were taken, starting from Items[0].
+		*/
+		size_t Push(Unique_Ptr<T>* Items, size_t Count)
+		{
+			size_t start;
+			auto claimed = Claim<Producers>(_enqueuePosition, 0, Count, start);
+			for (size_t i = 0; i < claimed; i++)
+			{
+				auto& slot = _slots[(start + i) & _mask];
+				slot.item = Items[i].Get();
+				Items[i].Release();
+				slot.sequence.store(start + i + 1, std::memory_order_release);
+			}
+			return claimed;
+		}
+
+		/*
+		* Returns an empty pointer if the queue is empty.
+		*/
+		[[nodiscard]] Unique_Ptr<T> Pop()
+		{
+			size_t start;
+			if (!Claim<Consumers>(_dequeuePosition, 1, 1, start))
+				return Unique_Ptr<T>();
+			auto& slot = _slots[start & _mask];
+			auto item = slot.item;
+			slot.sequence.store(start + _mask + 1, std::memory_order_release);
+			return Unique_Ptr<T>(item);
+		}
+
+		/*
+		* Pops up to Count items with a single claim into Output. Returns how many were popped.
+		*/
+		size_t Pop(Unique_Ptr<T>* Output, size_t Count)
+		{
+			size_t start;
+			auto claimed = Claim<Consumers>(_dequeuePosition, 1, Count, start);
+			for (size_t i = 0; i < claimed; i++)
+			{
+				auto& slot = _slots[(start + i) & _mask];
+				Output[i].Reset(slot.item);
+				slot.sequence.store(start + i + _mask + 1, std::memory_order_release);
+			}
+			return claimed;
+		}
+
+		Concurrent_Queue(const Concurrent_Queue&) = delete;
+		Concurrent_Queue& operator =(const Concurrent_Queue&) = delete;
+	};
+
+	/*
+	* Single-producer/single-consumer specialization: a plain ring with one index per side, each side caching the other's index
+	* so most operations touch no shared cache line.
+	* @param T [Pointed-to type].
+	*/
+	template <typename T>
+	class Concurrent_Queue<T, Queue_Access::SINGLE, Queue_Access::SINGLE>
+	{
+		static_assert(!is_array_v<T>, "Concurrent_Queue transfers single objects.");
+
+		static constexpr size_t cache_line_size = 64;
+
+		T** _items;
+		size_t _mask;
+		alignas(cache_line_size) std::atomic<size_t> _head{ 0 }; //Next position to pop.
+		size_t _cachedTail = 0; //Consumer's view of _tail.
+		alignas(cache_line_size) std::atomic<size_t> _tail{ 0 }; //Next position to push.
+		size_t _cachedHead = 0; //Producer's view of _head.
+
+		static size_t RoundCapacity(size_t Capacity) noexcept
+		{
+			size_t capacity = 2;
+			while (capacity < Capacity)
+				capacity <<= 1;
+			return capacity;
+		}
+
+		size_t Free(size_t Tail, size_t Wanted)
+		{
+			if (_mask + 1 - (Tail - _cachedHead) < Wanted)
+				_cachedHead = _head.load(std::memory_order_acquire);
+			return _mask + 1 - (Tail - _cachedHead);
+		}
+
+		size_t Filled(size_t Head, size_t Wanted)
+		{
+			if (_cachedTail - Head < Wanted)
+				_cachedTail = _tail.load(std::memory_order_acquire);
+			return _cachedTail - Head;
+		}
+
+	public:
+		/*
+		* @param Capacity [Minimum number of items the queue can hold, rounded up to a power of two].
+		*/
+		[[nodiscard]] explicit Concurrent_Queue(size_t Capacity) : _mask(RoundCapacity(Capacity) - 1)
+		{
+			_items = new T*[_mask + 1];
+		}
+
+		~Concurrent_Queue()
+		{
+			while (Pop().Valid())
+			{
+			}
+			delete[] _items;
+		}
+
+		size_t Capacity() const noexcept
+		{
+			return _mask + 1;
+		}
+
+		//Approximate when called from neither the producer nor the consumer.
+		size_t Size() const noexcept
+		{
+			auto head = _head.load(std::memory_order_relaxed);
+			auto tail = _tail.load(std::memory_order_relaxed);
+			return tail > head ? tail - head : 0;
+		}
+
+		bool Push(Unique_Ptr<T>&& Item)
+		{
+			auto tail = _tail.load(std::memory_order_relaxed);
+			if (Free(tail, 1) == 0)
+				return false;
+			_items[tail & _mask] = Item.Get();
+			Item.Release();
+			_tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		size_t Push(Unique_Ptr<T>* Items, size_t Count)
+		{
+			auto tail = _tail.load(std::memory_order_relaxed);
+			auto available = Free(tail, Count);
+			auto count = Count < available ? Count : available;
+			for (size_t i = 0; i < count; i++)
+			{
+				_items[(tail + i) & _mask] = Items[i].Get();
+				Items[i].Release();
+			}
+			_tail.store(tail + count, std::memory_order_release);
+			return count;
+		}
+
+		[[nodiscard]] Unique_Ptr<T> Pop()
+		{
+			auto head = _head.load(std::memory_order_relaxed);
+			if (Filled(head, 1) == 0)
+				return Unique_Ptr<T>();
+			auto item = _items[head & _mask];
+			_head.store(head + 1, std::memory_order_release);
+			return Unique_Ptr<T>(item);
+		}
+
+		size_t Pop(Unique_Ptr<T>* Output, size_t Count)
+		{
+			auto head = _head.load(std::memory_order_relaxed);
+			auto filled = Filled(head, Count);
+			auto count = Count < filled ? Count : filled;
+			for (size_t i = 0; i < count; i++)
+				Output[i].Reset(_items[(head + i) & _mask]);
+			_head.store(head + count, std::memory_order_release);
+			return count;
+		}
+
+		Concurrent_Queue(const Concurrent_Queue&) = delete;
+		Concurrent_Queue& operator =(const Concurrent_Queue&) = delete;
+	};
+
+	template <typename T>
+	using MPMC_Queue = Concurrent_Queue<T, Queue_Access::MULTIPLE, Queue_Access::MULTIPLE>;
+
+	template <typename T>
+	using MPSC_Queue = Concurrent_Queue<T, Queue_Access::MULTIPLE, Queue_Access::SINGLE>;
+
+	template <typename T>
+	using SPSC_Queue = Concurrent_Queue<T, Queue_Access::SINGLE, Queue_Access::SINGLE>;
+#pragma endregion Concurrent_Queue
+}
+
+#endif CONCURRENT_QUEUE_H
\ No newline at end of file
@@ -0,0 +1,264 @@
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "Definitions.h"
+#include "Type_Traits.h"
+
+namespace ACBYTES
+{
+#pragma region Epoch
+	/*
+	* Epoch-based reclamation (Fraser) for lock-free readers. Readers hold a Guard while they dereference shared nodes, writers
+	* Retire what they unlinked, and a retired pointer is freed once the global epoch moved twice past the epoch it was retired in,
+	* which can only happen after every thread that was inside a Guard back then has left it.
+	* Guards nest and are cheap: a thread_local lookup, a store and a fence. A thread stuck inside a Guard holds back all reclamation.
+	* Deleters run on whichever thread collects, never while holding the retiring structure's locks if it retires after unlocking.
+	*/
+	struct Epoch final
+	{
+	public:
+		NO_DEFAULT_CONSTRUCTORS(Epoch);
+
+		class Guard
+		{
+		public:
+			[[nodiscard]] Guard() noexcept
+			{
+				Enter();
+			}
+
+			~Guard()
+			{
+				Exit();
+			}
+
+			Guard(const Guard&) = delete;
+			Guard& operator =(const Guard&) = delete;
+		};
+
+	private:
+		static constexpr size_t cache_line_size = 64;
+		static constexpr size_t collect_interval = 64;
+
+		struct Retired
+		{
+			void* ptr;
+			void (*deleter)(void*);
+		};
+
+		struct alignas(cache_line_size) Record
+		{
+			//(epoch << 1) | 1 while inside a Guard, 0 outside.
+			std::atomic<uint64_t> state{ 0 };
+			std::atomic<bool> inUse{ true };
+			Record* next = nullptr;
+			uint32_t depth = 0;
+			size_t sinceCollect = 0;
+			std::vector<Retired> limbo[3];
+			uint64_t limboEpoch[3] = { 0, 0, 0 };
+		};
+
+		struct Domain
+		{
+			std::atomic<uint64_t> epoch{ 0 };
+			std::atomic<Record*> records{ nullptr };
+			std::mutex orphanMutex;
+			std::vector<std::pair<uint64_t, Retired>> orphans;
+
+			//Threads are gone by now, so nothing is being read.
+			~Domain()
+			{
+				for (auto& orphan : orphans)
+					orphan.second.deleter(orphan.second.ptr);
+				for (auto record = records.load(std::memory_order_acquire); record;)
+				{
+					auto next = record->next;
+					for (auto& limbo : record->limbo)
+						Free(limbo);
+					delete record;
+					record = next;
+				}
+			}
+		};
+
+		/*
+		* Gives the thread's retired pointers to the domain and frees its record for another thread when the thread exits.
+		*/
+		struct Record_Holder
+		{
+			Record* record;
+
+			~Record_Holder()
+			{
+				auto& domain = GetDomain();
+				{
+					std::lock_guard<std::mutex> mLock(domain.orphanMutex);
+					for (size_t i = 0; i < 3; i++)
+					{
+						for (auto& retired : record->limbo[i])
+							domain.orphans.emplace_back(record->limboEpoch[i], retired);
+						record->limbo[i].clear();
+					}
+				}
+				record->state.store(0, std::memory_order_release);
+				record->inUse.store(false, std::memory_order_release);
+			}
+		};
+
+		static Domain& GetDomain()
+		{
+			static Domain domain;
+			return domain;
+		}
+
+		static Record* AcquireRecord()
+		{
+			auto& domain = GetDomain();
+			for (auto record = domain.records.load(std::memory_order_acquire); record; record = record->next)
+			{
+				bool expected = false;
+				if (!record->inUse.load(std::memory_order_relaxed) && record->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+					return record;
+			}
+
+			auto record = new Record();
+			auto head = domain.records.load(std::memory_order_relaxed);
+			do
+				record->next = head;
+			while (!domain.records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+			return record;
+		}
+
+		static Record& LocalRecord()
+		{
+			static thread_local Record_Holder holder{ AcquireRecord() };
+			return *holder.record;
+		}
+
+		/*
+		* Runs the deleters of Items, which is emptied first since deleters may retire more.
+		*/
+		static void Free(std::vector<Retired>& Items)
+		{
+			if (Items.empty())
+				return;
+			auto retired = Move(Items);
+			Items.clear();
+			for (auto& item : retired)
+				item.deleter(item.ptr);
+		}
+
+		/*
+		* Moves the global epoch forward if every thread inside a Guard has seen the current one. Returns the global epoch.
+		*/
+		static uint64_t TryAdvance()
+		{
+			auto& domain = GetDomain();
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			auto epoch = domain.epoch.load(std::memory_order_acquire);
+			for (auto record = domain.records.load(std::memory_order_acquire); record; record = record->next)
+			{
+				//Acquire pairs with Exit, ordering the reader's last accesses before anything freed afterwards.
+				auto state = record->state.load(std::memory_order_acquire);
+				if ((state & 1) && (state >> 1) != epoch)
+					return epoch;
+			}
+			if (domain.epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+				return epoch + 1;
+			return epoch;
+		}
+
+	public:
+		static void Enter() noexcept
+		{
+			auto& record = LocalRecord();
+			if (record.depth++ == 0)
+			{
+				record.state.store((GetDomain().epoch.load(std::memory_order_relaxed) << 1) | 1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+			}
+		}
+
+		static void Exit() noexcept
+		{
+			auto& record = LocalRecord();
+			if (--record.depth == 0)
+				record.state.store(0, std::memory_order_release);
+		}
+
+		/*
+		* Frees Ptr with Deleter once no Guard that may still see it is alive. Ptr must already be unreachable for new readers.
+		*/
+		static void Retire(void* Ptr, void (*Deleter)(void*))
+		{
+			auto& record = LocalRecord();
+			auto epoch = GetDomain().epoch.load(std::memory_order_seq_cst);
+			auto index = epoch % 3;
+			if (record.limboEpoch[index] != epoch)
+			{
+				//Left from three or more epochs ago.
+				Free(record.limbo[index]);
+				record.limboEpoch[index] = epoch;
+			}
+			record.limbo[index].push_back(Retired{ Ptr, Deleter });
+			if (++record.sinceCollect >= collect_interval)
+				Collect();
+		}
+
+		template <typename T>
+		static void Retire(T* Ptr)
+		{
+			Retire(Ptr, [](void* Object)
+			{
+				delete static_cast<T*>(Object);
+			});
+		}
+
+		/*
+		* Tries to advance the epoch and frees what the calling thread, or exited threads, retired at least two epochs ago.
+		* Retire calls it every few retirements.
+		*/
+		static void Collect()
+		{
+			auto& record = LocalRecord();
+			record.sinceCollect = 0;
+			auto epoch = TryAdvance();
+			for (size_t i = 0; i < 3; i++)
+			{
+				if (record.limboEpoch[i] + 2 <= epoch)
+					Free(record.limbo[i]);
+			}
+
+			auto& domain = GetDomain();
+			std::vector<Retired> ready;
+			{
+				std::unique_lock<std::mutex> mLock(domain.orphanMutex, std::try_to_lock);
+				if (!mLock.owns_lock())
+					return;
+				for (size_t i = 0; i < domain.orphans.size();)
+				{
+					if (domain.orphans[i].first + 2 <= epoch)
+					{
+						ready.push_back(domain.orphans[i].second);
+						domain.orphans[i] = domain.orphans.back();
+						domain.orphans.pop_back();
+					}
+					else
+						i++;
+				}
+			}
+			Free(ready);
+		}
+	};
+#pragma endregion Epoch
+}
+
+#endif EPOCH_H
\ No newline at end of file
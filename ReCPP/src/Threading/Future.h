@@ -0,0 +1,560 @@
+#ifndef FUTURE_H
+#define FUTURE_H
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+#include "Smart_Pointers.h"
+#include "Type_Traits.h"
+#include "Job.h"
+#include "Thread_Pool.h"
+
+namespace ACBYTES
+{
+	template <typename T>
+	class Future;
+
+	template <typename T>
+	class Promise;
+
+#pragma region Future_State
+	template <typename T>
+	struct Future_Value
+	{
+	private:
+		alignas(T) unsigned char _storage[sizeof(T)];
+
+	public:
+		template <typename... ArgT>
+		void Emplace(ArgT&&... Arguments)
+		{
+			new (_storage) T(Forward<ArgT>(Arguments)...);
+		}
+
+		T& Get()
+		{
+			return *reinterpret_cast<T*>(_storage);
+		}
+
+		void Destroy()
+		{
+			Get().~T();
+		}
+	};
+
+	template <>
+	struct Future_Value<void>
+	{
+		void Emplace()
+		{
+		}
+
+		void Get()
+		{
+		}
+
+		void Destroy()
+		{
+		}
+	};
+
+	/*
+	* Condition variables that waiting futures park on once spinning gives up. Shared by hashing the state's address,
+	* so a future costs no space for them.
+	*/
+	struct Future_Parking
+	{
+		std::mutex mutex;
+		std::condition_variable condition;
+
+		static Future_Parking& For(const void* State) noexcept
+		{
+			static constexpr size_t lot_count = 16;
+			static Future_Parking lots[lot_count];
+			return lots[(reinterpret_cast<uintptr_t>(State) / 64) % lot_count];
+		}
+	};
+
+	/*
+	* State shared by a Promise and its Future. Lives in a single Make_Shared allocation; a single atomic word tracks readiness, the continuation and abandonment.
+	* The continuation is stored inline in a Job, so registering one does not allocate.
+	*/
+	template <typename T>
+	class Future_State
+	{
+		enum State_Flags : uint32_t
+		{
+			ready_flag = 1,
+			continuation_flag = 2,
+			abandoned_flag = 4,
+			waiting_flag = 8 //A thread is parked in Wait, finishing has to wake it.
+		};
+
+		std::atomic<uint32_t> _state{ 0 };
+		Future_Value<T> _value;
+		Job _continuation;
+
+		/*
+		* Runs the continuation from a local: it may own the last reference to this state, which is then freed when the local dies.
+		*/
+		void RunContinuation()
+		{
+			auto continuation = Move(_continuation);
+			continuation();
+		}
+
+		//Drops whatever the continuation captured, it will never run. Freed from a local for the same reason as above.
+		void DropContinuation()
+		{
+			auto continuation = Move(_continuation);
+		}
+
+		//Taking the lot's mutex orders this after a waiter's last check of Finished, so the notification can't be missed.
+		void Wake(uint32_t Previous)
+		{
+			if (!(Previous & waiting_flag))
+				return;
+			auto& parking = Future_Parking::For(this);
+			{
+				std::lock_guard<std::mutex> mLock(parking.mutex);
+			}
+			parking.condition.notify_all();
+		}
+
+	public:
+		Future_State() noexcept
+		{
+		}
+
+		~Future_State()
+		{
+			if (_state.load(std::memory_order_acquire) & ready_flag)
+				_value.Destroy();
+		}
+
+		bool Ready() const noexcept
+		{
+			return _state.load(std::memory_order_acquire) & ready_flag;
+		}
+
+		//Promise was destroyed without setting a value.
+		bool Abandoned() const noexcept
+		{
+			return (_state.load(std::memory_order_acquire) & (ready_flag | abandoned_flag)) == abandoned_flag;
+		}
+
+		bool Finished() const noexcept
+		{
+			return _state.load(std::memory_order_acquire) & (ready_flag | abandoned_flag);
+		}
+
+		template <typename... ArgT>
+		void SetValue(ArgT&&... Arguments)
+		{
+			_value.Emplace(Forward<ArgT>(Arguments)...);
+			auto previous = _state.fetch_or(ready_flag, std::memory_order_acq_rel);
+			Wake(previous);
+			if (previous & continuation_flag)
+				RunContinuation();
+		}
+
+		void Abandon()
+		{
+			auto previous = _state.fetch_or(abandoned_flag, std::memory_order_acq_rel);
+			Wake(previous);
+			if (previous & continuation_flag)
+				DropContinuation();
+		}
+
+		/*
+		* Stores Target to be called once the value is set; runs it right away if the value is already there.
+		* Only one continuation is allowed: a second one asserts, and is dropped without running in release builds.
+		*/
+		template <typename Callable>
+		void SetContinuation(Callable&& Target)
+		{
+			if (_state.load(std::memory_order_relaxed) & continuation_flag) //Only the consuming side sets it, no race with the check.
+			{
+				assert(!"A future can have only one continuation.");
+				return;
+			}
+			_continuation.Emplace(Forward<Callable>(Target));
+			auto previous = _state.fetch_or(continuation_flag, std::memory_order_acq_rel);
+			if (previous & ready_flag)
+				RunContinuation();
+			else if (previous & abandoned_flag)
+				DropContinuation();
+		}
+
+		/*
+		* Spins, then yields, then parks until the value is set or the promise is abandoned.
+		*/
+		void Wait()
+		{
+			for (uint32_t i = 0; i < 128; i++)
+			{
+				if (Finished())
+					return;
+				if (i >= 64)
+					std::this_thread::yield();
+			}
+			if (_state.fetch_or(waiting_flag, std::memory_order_acq_rel) & (ready_flag | abandoned_flag))
+				return;
+			auto& parking = Future_Parking::For(this);
+			std::unique_lock<std::mutex> mLock(parking.mutex);
+			parking.condition.wait(mLock, [this] { return Finished(); });
+		}
+
+		decltype(auto) Value()
+		{
+			return _value.Get();
+		}
+	};
+#pragma endregion Future_State
+
+#pragma region Promise
+	/*
+	* Producing end of a Future. Destroying a Promise without setting a value abandons the Future.
+	* @param T [Type of the value, void for a plain completion signal].
+	*/
+	template <typename T>
+	class Promise
+	{
+		Shared_Ptr<Future_State<T>> _state;
+
+	public:
+		[[nodiscard]] Promise() : _state(Make_Shared<Future_State<T>>())
+		{
+		}
+
+		[[nodiscard]] Promise(Promise&& Rvr) noexcept : _state(Move(Rvr._state))
+		{
+		}
+
+		Promise& operator =(Promise&& Rvr) noexcept
+		{
+			_state.Swap(Rvr._state); //The previous state gets abandoned by Rvr's destructor.
+			return *this;
+		}
+
+		~Promise()
+		{
+			if (_state.Get() && !_state.Get()->Ready())
+				_state.Get()->Abandon();
+		}
+
+		[[nodiscard]] Future<T> GetFuture() const
+		{
+			return Future<T>(_state);
+		}
+
+		template <typename... ArgT>
+		void SetValue(ArgT&&... Arguments)
+		{
+			_state.Get()->SetValue(Forward<ArgT>(Arguments)...);
+		}
+
+		Promise(const Promise&) = delete;
+		Promise& operator =(const Promise&) = delete;
+	};
+#pragma endregion Promise
+
+#pragma region Future
+	/*
+	* Consuming end of a Promise.
+	* @param T [Type of the value, void for a plain completion signal].
+	*/
+	template <typename T>
+	class Future
+	{
+		Shared_Ptr<Future_State<T>> _state;
+
+		template <typename> friend class Promise;
+		template <typename> friend class Future;
+		friend struct Future_Group;
+		template <typename> friend struct Future_Awaiter;
+
+		[[nodiscard]] explicit Future(const Shared_Ptr<Future_State<T>>& State) : _state(State)
+		{
+		}
+
+		template <typename Callable>
+		using continuation_result_t = typename conditional<invoke_result<Callable&>, invoke_result<Callable&, T>, is_same_v<T, void>>::result::type;
+
+		template <typename ResultType, typename Callable>
+		static void Fulfil(Future_State<T>& State, Promise<ResultType>& Target, Callable& Continuation)
+		{
+			if constexpr (is_same_v<T, void>)
+			{
+				if constexpr (is_same_v<ResultType, void>)
+				{
+					Continuation();
+					Target.SetValue();
+				}
+				else
+					Target.SetValue(Continuation());
+			}
+			else
+			{
+				if constexpr (is_same_v<ResultType, void>)
+				{
+					Continuation(Move(State.Value()));
+					Target.SetValue();
+				}
+				else
+					Target.SetValue(Continuation(Move(State.Value())));
+			}
+		}
+
+	public:
+		[[nodiscard]] Future() noexcept //Empty future.
+		{
+		}
+
+		[[nodiscard]] Future(Future&& Rvr) noexcept : _state(Move(Rvr._state))
+		{
+		}
+
+		Future& operator =(Future&& Rvr) noexcept
+		{
+			_state.Swap(Rvr._state);
+			return *this;
+		}
+
+		bool Valid() const noexcept
+		{
+			return _state.Get() != nullptr;
+		}
+
+		bool Ready() const noexcept
+		{
+			return _state.Get()->Ready();
+		}
+
+		bool Abandoned() const noexcept
+		{
+			return _state.Get()->Abandoned();
+		}
+
+		void Wait() const
+		{
+			_state.Get()->Wait();
+		}
+
+		/*
+		* Waits while executing the pool's pending jobs, so waiting from inside a pool job can't starve the pool.
+		*/
+		void Wait(Thread_Pool& Pool) const
+		{
+			while (!_state.Get()->Finished())
+			{
+				if (!Pool.TryRunOne())
+					std::this_thread::yield();
+			}
+		}
+
+		/*
+		* Waits for the value and moves it out. Must not be called on an abandoned future.
+		*/
+		T Get()
+		{
+			Wait();
+			if constexpr (!is_same_v<T, void>)
+				return Move(_state.Get()->Value());
+		}
+
+		/*
+		* Chains Target to run inline on the thread that completes this future (or on the caller if it is already complete). Consumes this future.
+		* @param Target [Called with the value (or nothing for void), its result fulfils the returned future].
+		*/
+		template <typename Callable>
+		[[nodiscard]] auto Then(Callable&& Target) -> Future<continuation_result_t<decay_t<Callable>>>
+		{
+			using resultType = continuation_result_t<decay_t<Callable>>;
+			Promise<resultType> promise;
+			auto future = promise.GetFuture();
+			auto state = _state.Get();
+			state->SetContinuation([owner = Move(_state), promise = Move(promise), target = decay_t<Callable>(Forward<Callable>(Target))]() mutable
+			{
+				Fulfil(*owner.Get(), promise, target);
+			});
+			return future;
+		}
+
+		/*
+		* Chains Target to run as a job on Executor once this future completes. Consumes this future.
+		* @param Executor [Pool that runs the continuation].
+		* @param Target [Called with the value (or nothing for void), its result fulfils the returned future].
+		*/
+		template <typename Callable>
+		[[nodiscard]] auto Then(Thread_Pool& Executor, Callable&& Target) -> Future<continuation_result_t<decay_t<Callable>>>
+		{
+			using resultType = continuation_result_t<decay_t<Callable>>;
+			Promise<resultType> promise;
+			auto future = promise.GetFuture();
+			auto state = _state.Get();
+			state->SetContinuation([&Executor, owner = Move(_state), promise = Move(promise), target = decay_t<Callable>(Forward<Callable>(Target))]() mutable
+			{
+				Executor.Submit([owner = Move(owner), promise = Move(promise), target = Move(target)]() mutable
+				{
+					Fulfil(*owner.Get(), promise, target);
+				});
+			});
+			return future;
+		}
+
+		Future(const Future&) = delete;
+		Future& operator =(const Future&) = delete;
+	};
+#pragma endregion Future
+
+#pragma region When_All_When_Any
+	/*
+	* Implementation of When_All/When_Any. Each input future gets a continuation holding a token; the token's destructor reports completion,
+	* so both a fulfilled and an abandoned input count down with a single atomic operation and no locking.
+	*/
+	struct Future_Group
+	{
+		NO_DEFAULT_CONSTRUCTORS(Future_Group);
+
+		/*
+		* @param ResultType [void for When_All, index of the first completed input (size_t) for When_Any].
+		*/
+		template <typename ResultType>
+		struct Group_State
+		{
+			std::atomic<size_t> remaining;
+			std::atomic<bool> claimed{ false };
+			Promise<ResultType> promise;
+
+			Group_State(size_t Count) : remaining(Count)
+			{
+			}
+		};
+
+		template <typename ResultType>
+		class Token
+		{
+			Group_State<ResultType>* _group;
+			size_t _index;
+			bool _fulfilled = false;
+
+		public:
+			Token(Group_State<ResultType>* Group, size_t Index) noexcept : _group(Group), _index(Index)
+			{
+			}
+
+			Token(Token&& Rvr) noexcept : _group(Rvr._group), _index(Rvr._index), _fulfilled(Rvr._fulfilled)
+			{
+				Rvr._group = nullptr;
+			}
+
+			~Token()
+			{
+				if (!_group)
+					return;
+				if constexpr (!is_same_v<ResultType, void>)
+				{
+					if (_fulfilled && !_group->claimed.exchange(true, std::memory_order_acq_rel))
+						_group->promise.SetValue(_index);
+				}
+				if (_group->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					if constexpr (is_same_v<ResultType, void>)
+						_group->promise.SetValue();
+					delete _group; //An unclaimed When_Any promise gets abandoned here.
+				}
+			}
+
+			void Fulfil() noexcept
+			{
+				_fulfilled = true;
+			}
+
+			Token(const Token&) = delete;
+			Token& operator =(const Token&) = delete;
+		};
+
+		template <typename ResultType, typename T>
+		static void Attach(Group_State<ResultType>* Group, Future<T>& Target, size_t Index)
+		{
+			Target._state.Get()->SetContinuation([token = Token<ResultType>(Group, Index)]() mutable
+			{
+				token.Fulfil();
+			});
+		}
+
+		//The returned future is taken before attaching, the group deletes itself once the last input completes.
+		template <typename ResultType, typename... T>
+		static Future<ResultType> Create(Future<T>&... Futures)
+		{
+			auto group = new Group_State<ResultType>(sizeof...(T));
+			auto future = group->promise.GetFuture();
+			size_t index = 0;
+			(Attach(group, Futures, index++), ...);
+			return future;
+		}
+
+		template <typename ResultType, typename T>
+		static Future<ResultType> Create(std::vector<Future<T>>& Futures)
+		{
+			auto group = new Group_State<ResultType>(Futures.size());
+			auto future = group->promise.GetFuture();
+			for (size_t i = 0; i < Futures.size(); i++)
+				Attach(group, Futures[i], i);
+			return future;
+		}
+	};
+
+	/*
+	* Future that completes once every input has completed (or was abandoned). Inputs keep their values for Get but can't be chained
+	* with Then afterwards, see Future_State::SetContinuation.
+	*/
+	template <typename... T>
+	[[nodiscard]] Future<void> When_All(Future<T>&... Futures)
+	{
+		static_assert(sizeof...(T) > 0, "When_All needs at least one future.");
+		return Future_Group::Create<void>(Futures...);
+	}
+
+	template <typename T>
+	[[nodiscard]] Future<void> When_All(std::vector<Future<T>>& Futures)
+	{
+		if (Futures.empty())
+		{
+			Promise<void> promise;
+			promise.SetValue();
+			return promise.GetFuture();
+		}
+		return Future_Group::Create<void>(Futures);
+	}
+
+	/*
+	* Future holding the index of the first input that completed. Abandoned if every input gets abandoned.
+	* Inputs keep their values for Get but can't be chained with Then afterwards.
+	*/
+	template <typename... T>
+	[[nodiscard]] Future<size_t> When_Any(Future<T>&... Futures)
+	{
+		static_assert(sizeof...(T) > 0, "When_Any needs at least one future.");
+		return Future_Group::Create<size_t>(Futures...);
+	}
+
+	template <typename T>
+	[[nodiscard]] Future<size_t> When_Any(std::vector<Future<T>>& Futures)
+	{
+		if (Futures.empty())
+			return Promise<size_t>().GetFuture(); //Abandoned right away.
+		return Future_Group::Create<size_t>(Futures);
+	}
+#pragma endregion When_All_When_Any
+}
+
+#endif FUTURE_H
\ No newline at end of file
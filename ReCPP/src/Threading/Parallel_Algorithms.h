@@ -0,0 +1,233 @@
+#ifndef PARALLEL_ALGORITHMS_H
+#define PARALLEL_ALGORITHMS_H
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+#include "Type_Traits.h"
+#include "Smart_Pointers.h"
+#include "Thread_Pool.h"
+
+namespace ACBYTES
+{
+#pragma region Parallel_Algorithms
+	/*
+	* Chunk size used when Grain is 0: roughly 64 KiB worth of elements so a chunk stays in the core's cache,
+	* raised on huge arrays to keep the job count around 64 per worker. Arrays no bigger than one chunk run sequentially.
+	*/
+	template <typename T>
+	size_t Parallel_Grain(const Thread_Pool& Pool, size_t Size, size_t Grain) noexcept
+	{
+		if (Grain)
+			return Grain;
+		constexpr size_t chunk_bytes = 64 * 1024;
+		size_t grain = chunk_bytes / sizeof(T) ? chunk_bytes / sizeof(T) : 1;
+		auto balanced = Size / (Pool.ThreadCount() * 64);
+		return balanced > grain ? balanced : grain;
+	}
+
+	/*
+	* Calls Body on every element.
+	* @param Body [Callable taking T&].
+	* @param Grain [Largest chunk handed to one job, 0 picks a cache-sized one].
+	*/
+	template <typename Array, typename Callable>
+	void Parallel_For_Each(Thread_Pool& Pool, Array& Target, Callable&& Body, size_t Grain = 0)
+	{
+		using type = array_element_t<Array>;
+		auto data = Target.Get();
+		auto size = Target.Size();
+		auto grain = Parallel_Grain<type>(Pool, size, Grain);
+		if (size <= grain)
+		{
+			for (size_t i = 0; i < size; i++)
+				Body(data[i]);
+			return;
+		}
+		Pool.ParallelFor(0, size, [data, &Body](size_t Begin, size_t End)
+		{
+			for (size_t i = Begin; i < End; i++)
+				Body(data[i]);
+		}, grain);
+	}
+
+	/*
+	* Stores Operation(Source[i]) into Destination[i] for the elements both arrays have. Source and Destination may be the same array.
+	* @param Operation [Callable taking const T& and returning a value assignable to Destination's elements].
+	*/
+	template <typename Source_Array, typename Destination_Array, typename Callable>
+	void Parallel_Transform(Thread_Pool& Pool, Source_Array& Source, Destination_Array& Destination, Callable&& Operation, size_t Grain = 0)
+	{
+		using type = array_element_t<Source_Array>;
+		auto source = Source.Get();
+		auto destination = Destination.Get();
+		auto size = Source.Size() < Destination.Size() ? Source.Size() : Destination.Size();
+		auto grain = Parallel_Grain<type>(Pool, size, Grain);
+		if (size <= grain)
+		{
+			for (size_t i = 0; i < size; i++)
+				destination[i] = Operation(static_cast<const type&>(source[i]));
+			return;
+		}
+		Pool.ParallelFor(0, size, [source, destination, &Operation](size_t Begin, size_t End)
+		{
+			for (size_t i = Begin; i < End; i++)
+				destination[i] = Operation(static_cast<const type&>(source[i]));
+		}, grain);
+	}
+
+	/*
+	* Folds every chunk into its own partial result starting from Init, then folds the partials in order with Combine.
+	* Init must be an identity of Combine and both operations associative, like for std::reduce.
+	* @param Reduce [Callable taking (R, const T&) and returning R].
+	* @param Combine [Callable taking (R, R) and returning R].
+	*/
+	template <typename Array, typename R, typename Reducer, typename Combiner, typename = decltype(Declval<Combiner&>()(Declval<R>(), Declval<R>()))>
+	[[nodiscard]] R Parallel_Reduce(Thread_Pool& Pool, Array& Target, R Init, Reducer&& Reduce, Combiner&& Combine, size_t Grain = 0)
+	{
+		using type = array_element_t<Array>;
+		auto data = Target.Get();
+		auto size = Target.Size();
+		auto grain = Parallel_Grain<type>(Pool, size, Grain);
+		if (size <= grain)
+		{
+			for (size_t i = 0; i < size; i++)
+				Init = Reduce(Move(Init), static_cast<const type&>(data[i]));
+			return Init;
+		}
+
+		struct alignas(64) Partial //One cache line each, chunks finishing together don't share lines.
+		{
+			R value;
+		};
+
+		auto chunks = (size + grain - 1) / grain;
+		std::vector<Partial> partials(chunks, Partial{ Init });
+		Pool.ParallelFor(0, chunks, [&](size_t Begin, size_t End)
+		{
+			for (size_t chunk = Begin; chunk < End; chunk++)
+			{
+				auto end = (chunk + 1) * grain < size ? (chunk + 1) * grain : size;
+				auto& partial = partials[chunk].value;
+				for (size_t i = chunk * grain; i < end; i++)
+					partial = Reduce(Move(partial), static_cast<const type&>(data[i]));
+			}
+		}, 1);
+
+		for (auto& partial : partials)
+			Init = Combine(Move(Init), Move(partial.value));
+		return Init;
+	}
+
+	/*
+	* Parallel_Reduce with one operation for both folding elements and combining partials.
+	*/
+	template <typename Array, typename R, typename Reducer>
+	[[nodiscard]] R Parallel_Reduce(Thread_Pool& Pool, Array& Target, R Init, Reducer&& Reduce, size_t Grain = 0)
+	{
+		return Parallel_Reduce(Pool, Target, Move(Init), Reduce, Reduce, Grain);
+	}
+
+	namespace Parallel_Detail
+	{
+		/*
+		* Merges two sorted runs into Output, splitting big merges at the middle of the longer run.
+		*/
+		template <typename T, typename Compare>
+		void Merge(Thread_Pool& Pool, T* A, size_t ACount, T* B, size_t BCount, T* Output, Compare& Comparer, size_t Grain)
+		{
+			if (ACount + BCount <= Grain)
+			{
+				std::merge(std::make_move_iterator(A), std::make_move_iterator(A + ACount), std::make_move_iterator(B), std::make_move_iterator(B + BCount), Output, Comparer);
+				return;
+			}
+			if (ACount < BCount)
+			{
+				auto run = A;
+				A = B;
+				B = run;
+				auto count = ACount;
+				ACount = BCount;
+				BCount = count;
+			}
+
+			auto aMiddle = ACount / 2;
+			auto bMiddle = static_cast<size_t>(std::lower_bound(B, B + BCount, A[aMiddle], Comparer) - B);
+			Wait_Group group;
+			Pool.Submit(group, [&]() { Merge(Pool, A, aMiddle, B, bMiddle, Output, Comparer, Grain); });
+			Merge(Pool, A + aMiddle, ACount - aMiddle, B + bMiddle, BCount - bMiddle, Output + aMiddle + bMiddle, Comparer, Grain);
+			Pool.Wait(group);
+		}
+	}
+
+	/*
+	* Sorts the array: chunks are sorted in parallel, then merged pairwise in rounds through a scratch buffer of the same size,
+	* every merge itself split across the pool. Not stable. Elements must be default constructible and move assignable.
+	* @param Comparer [Strict weak ordering taking (const T&, const T&)].
+	*/
+	template <typename Array, typename Compare, typename = decltype(Declval<Compare&>()(Declval<const array_element_t<Array>&>(), Declval<const array_element_t<Array>&>()))>
+	void Parallel_Sort(Thread_Pool& Pool, Array& Target, Compare Comparer, size_t Grain = 0)
+	{
+		using type = array_element_t<Array>;
+		auto data = Target.Get();
+		auto size = Target.Size();
+		auto grain = Parallel_Grain<type>(Pool, size, Grain);
+		if (size <= grain)
+		{
+			std::sort(data, data + size, Comparer);
+			return;
+		}
+
+		auto chunks = (size + grain - 1) / grain;
+		Pool.ParallelFor(0, chunks, [&](size_t Begin, size_t End)
+		{
+			for (size_t chunk = Begin; chunk < End; chunk++)
+			{
+				auto end = (chunk + 1) * grain < size ? (chunk + 1) * grain : size;
+				std::sort(data + chunk * grain, data + end, Comparer);
+			}
+		}, 1);
+
+		Unique_Ptr<type[]> buffer(new type[size], size);
+		auto source = data;
+		auto destination = buffer.Get();
+		for (size_t width = grain; width < size; width *= 2)
+		{
+			auto pairs = (size + 2 * width - 1) / (2 * width);
+			Pool.ParallelFor(0, pairs, [&](size_t Begin, size_t End)
+			{
+				for (size_t pair = Begin; pair < End; pair++)
+				{
+					auto begin = pair * 2 * width;
+					auto middle = begin + width < size ? begin + width : size;
+					auto end = middle + width < size ? middle + width : size;
+					Parallel_Detail::Merge(Pool, source + begin, middle - begin, source + middle, end - middle, destination + begin, Comparer, grain);
+				}
+			}, 1);
+			auto run = source;
+			source = destination;
+			destination = run;
+		}
+
+		if (source != data)
+		{
+			Pool.ParallelFor(0, size, [&](size_t Begin, size_t End)
+			{
+				std::move(source + Begin, source + End, data + Begin);
+			}, grain);
+		}
+	}
+
+	template <typename Array>
+	void Parallel_Sort(Thread_Pool& Pool, Array& Target, size_t Grain = 0)
+	{
+		using type = array_element_t<Array>;
+		Parallel_Sort(Pool, Target, [](const type& Left, const type& Right) { return Left < Right; }, Grain);
+	}
+#pragma endregion Parallel_Algorithms
+}
+
+#endif PARALLEL_ALGORITHMS_H
\ No newline at end of file
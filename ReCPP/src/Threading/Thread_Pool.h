@@ -0,0 +1,524 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Definitions.h"
+#include "Type_Traits.h"
+#include "Function_Ref.h"
+#include "Job.h"
+
+namespace ACBYTES
+{
+#pragma region Wait_Group
+	/*
+	* Counts outstanding jobs. Thread_Pool::Wait helps executing jobs until the count drops to zero.
+	*/
+	class Wait_Group
+	{
+		std::atomic<size_t> _count{ 0 };
+
+	public:
+		Wait_Group() noexcept
+		{
+		}
+
+		void Add(size_t Count = 1) noexcept
+		{
+			_count.fetch_add(Count, std::memory_order_relaxed);
+		}
+
+		void Done() noexcept
+		{
+			_count.fetch_sub(1, std::memory_order_release);
+		}
+
+		size_t Count() const noexcept
+		{
+			return _count.load(std::memory_order_acquire);
+		}
+
+		bool Finished() const noexcept
+		{
+			return Count() == 0;
+		}
+
+		Wait_Group(const Wait_Group&) = delete;
+		Wait_Group& operator =(const Wait_Group&) = delete;
+	};
+#pragma endregion Wait_Group
+
+#pragma region Thread_Pool
+	/*
+	* Work-stealing thread pool. Every worker owns a Chase-Lev deque: it pushes/pops at the bottom, idle workers steal from the top of a random victim.
+	* Jobs submitted from outside the pool go through a shared injection queue.
+	* Job nodes are recycled per worker, so submitting callables that fit Job's inline storage does not touch the heap once the pool is warm.
+	*/
+	class Thread_Pool
+	{
+		static constexpr size_t cache_line_size = 64;
+		static constexpr size_t node_chunk_size = 64;
+
+		struct Job_Cache;
+
+		struct Job_Node
+		{
+			Job job;
+			Job_Node* next = nullptr;
+			Job_Cache* owner = nullptr;
+		};
+
+		/*
+		* Free list of job nodes. The owning thread uses _free without synchronization; other threads hand nodes back through _returned.
+		*/
+		struct Job_Cache
+		{
+			Job_Node* _free = nullptr;
+			std::atomic<Job_Node*> _returned{ nullptr };
+			std::vector<Job_Node*> _chunks;
+
+			~Job_Cache()
+			{
+				for (auto chunk : _chunks)
+					delete[] chunk;
+			}
+
+			Job_Node* Acquire()
+			{
+				if (!_free)
+					_free = _returned.exchange(nullptr, std::memory_order_acquire);
+				if (!_free)
+				{
+					auto chunk = new Job_Node[node_chunk_size];
+					_chunks.push_back(chunk);
+					for (size_t i = 0; i < node_chunk_size; i++)
+					{
+						chunk[i].owner = this;
+						chunk[i].next = i + 1 < node_chunk_size ? &chunk[i + 1] : nullptr;
+					}
+					_free = chunk;
+				}
+				auto node = _free;
+				_free = node->next;
+				return node;
+			}
+
+			void ReleaseLocal(Job_Node* Node)
+			{
+				Node->next = _free;
+				_free = Node;
+			}
+
+			void ReleaseRemote(Job_Node* Node)
+			{
+				auto head = _returned.load(std::memory_order_relaxed);
+				do
+				{
+					Node->next = head;
+				} while (!_returned.compare_exchange_weak(head, Node, std::memory_order_release, std::memory_order_relaxed));
+			}
+		};
+
+		/*
+		* Chase-Lev deque of job nodes (Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models").
+		*/
+		class Work_Stealing_Deque
+		{
+			struct Ring
+			{
+				int64_t capacity;
+				int64_t mask;
+				std::atomic<Job_Node*>* slots;
+
+				Ring(int64_t Capacity) : capacity(Capacity), mask(Capacity - 1), slots(new std::atomic<Job_Node*>[Capacity])
+				{
+				}
+
+				~Ring()
+				{
+					delete[] slots;
+				}
+
+				Job_Node* Get(int64_t Index) const
+				{
+					return slots[Index & mask].load(std::memory_order_relaxed);
+				}
+
+				void Put(int64_t Index, Job_Node* Node)
+				{
+					slots[Index & mask].store(Node, std::memory_order_relaxed);
+				}
+			};
+
+			alignas(cache_line_size) std::atomic<int64_t> _top{ 0 };
+			alignas(cache_line_size) std::atomic<int64_t> _bottom{ 0 };
+			std::atomic<Ring*> _ring;
+			std::vector<Ring*> _retired; //Outgrown rings stay alive until destruction, thieves may still be reading them.
+
+			Ring* Grow(Ring* Old, int64_t Bottom, int64_t Top)
+			{
+				auto ring = new Ring(Old->capacity * 2);
+				for (auto i = Top; i < Bottom; i++)
+					ring->Put(i, Old->Get(i));
+				_retired.push_back(Old);
+				_ring.store(ring, std::memory_order_release);
+				return ring;
+			}
+
+		public:
+			Work_Stealing_Deque(int64_t Capacity = 256) : _ring(new Ring(Capacity))
+			{
+			}
+
+			~Work_Stealing_Deque()
+			{
+				delete _ring.load(std::memory_order_relaxed);
+				for (auto ring : _retired)
+					delete ring;
+			}
+
+			//Owner only.
+			void Push(Job_Node* Node)
+			{
+				auto bottom = _bottom.load(std::memory_order_relaxed);
+				auto top = _top.load(std::memory_order_acquire);
+				auto ring = _ring.load(std::memory_order_relaxed);
+				if (bottom - top > ring->capacity - 1)
+					ring = Grow(ring, bottom, top);
+				ring->Put(bottom, Node);
+				std::atomic_thread_fence(std::memory_order_release);
+				_bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+
+			//Owner only.
+			Job_Node* Pop()
+			{
+				auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+				auto ring = _ring.load(std::memory_order_relaxed);
+				_bottom.store(bottom, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				auto top = _top.load(std::memory_order_relaxed);
+				Job_Node* node = nullptr;
+				if (top <= bottom)
+				{
+					node = ring->Get(bottom);
+					if (top == bottom)
+					{
+						if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+							node = nullptr;
+						_bottom.store(bottom + 1, std::memory_order_relaxed);
+					}
+				}
+				else
+					_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return node;
+			}
+
+			Job_Node* Steal()
+			{
+				auto top = _top.load(std::memory_order_acquire);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				auto bottom = _bottom.load(std::memory_order_acquire);
+				if (top < bottom)
+				{
+					auto node = _ring.load(std::memory_order_acquire)->Get(top);
+					if (_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+						return node;
+				}
+				return nullptr;
+			}
+
+			Work_Stealing_Deque(const Work_Stealing_Deque&) = delete;
+			Work_Stealing_Deque& operator =(const Work_Stealing_Deque&) = delete;
+		};
+
+		struct alignas(cache_line_size) Worker
+		{
+			Work_Stealing_Deque deque;
+			Job_Cache cache;
+			uint64_t randomState;
+			std::thread thread;
+		};
+
+		std::vector<Worker*> _workers;
+		std::deque<Job_Node*> _injected;
+		Job_Cache _injectedCache; //Guarded by _injectedMutex.
+		std::mutex _injectedMutex;
+
+		alignas(cache_line_size) std::atomic<size_t> _pending{ 0 };
+		std::atomic<size_t> _sleeping{ 0 };
+		std::atomic<bool> _stop{ false };
+		std::mutex _sleepMutex;
+		std::condition_variable _sleepCondition;
+
+		struct Thread_Context
+		{
+			Thread_Pool* pool;
+			Worker* worker;
+		};
+
+		static Thread_Context& CurrentContext() noexcept
+		{
+			static thread_local Thread_Context context{ nullptr, nullptr };
+			return context;
+		}
+
+		Worker* CurrentWorker() const noexcept
+		{
+			auto& context = CurrentContext();
+			return context.pool == this ? context.worker : nullptr;
+		}
+
+		static uint64_t NextRandom(uint64_t& State) noexcept
+		{
+			State ^= State << 13;
+			State ^= State >> 7;
+			State ^= State << 17;
+			return State;
+		}
+
+		template <typename Callable>
+		void Push(Callable&& Target)
+		{
+			if (auto worker = CurrentWorker())
+			{
+				auto node = worker->cache.Acquire();
+				node->job.Emplace(Forward<Callable>(Target));
+				worker->deque.Push(node);
+			}
+			else
+			{
+				std::lock_guard<std::mutex> mLock(_injectedMutex);
+				auto node = _injectedCache.Acquire();
+				node->job.Emplace(Forward<Callable>(Target));
+				_injected.push_back(node);
+			}
+			_pending.fetch_add(1, std::memory_order_seq_cst);
+			if (_sleeping.load(std::memory_order_seq_cst) > 0)
+			{
+				std::lock_guard<std::mutex> mLock(_sleepMutex);
+				_sleepCondition.notify_one();
+			}
+		}
+
+		Job_Node* Find(Worker* Self, uint64_t& RandomState)
+		{
+			Job_Node* node = nullptr;
+			if (Self)
+				node = Self->deque.Pop();
+			if (!node && !_workers.empty())
+			{
+				auto count = _workers.size();
+				auto start = static_cast<size_t>(NextRandom(RandomState) % count);
+				for (size_t i = 0; i < count && !node; i++)
+				{
+					auto victim = _workers[(start + i) % count];
+					if (victim != Self)
+						node = victim->deque.Steal();
+				}
+			}
+			if (!node)
+			{
+				std::lock_guard<std::mutex> mLock(_injectedMutex);
+				if (!_injected.empty())
+				{
+					node = _injected.front();
+					_injected.pop_front();
+				}
+			}
+			if (node)
+				_pending.fetch_sub(1, std::memory_order_relaxed);
+			return node;
+		}
+
+		void Execute(Job_Node* Node, Worker* Self)
+		{
+			Node->job();
+			Node->job.Reset();
+			if (Self && Node->owner == &Self->cache)
+				Self->cache.ReleaseLocal(Node);
+			else
+				Node->owner->ReleaseRemote(Node);
+		}
+
+		void WorkerLoop(Worker* Self)
+		{
+			CurrentContext() = Thread_Context{ this, Self };
+			while (true)
+			{
+				if (auto node = Find(Self, Self->randomState))
+				{
+					Execute(node, Self);
+					continue;
+				}
+
+				std::unique_lock<std::mutex> mLock(_sleepMutex);
+				_sleeping.fetch_add(1, std::memory_order_seq_cst);
+				_sleepCondition.wait(mLock, [this] { return _pending.load(std::memory_order_seq_cst) > 0 || _stop.load(std::memory_order_relaxed); });
+				_sleeping.fetch_sub(1, std::memory_order_relaxed);
+				if (_stop.load(std::memory_order_relaxed) && _pending.load(std::memory_order_seq_cst) == 0)
+					break;
+			}
+			CurrentContext() = Thread_Context{ nullptr, nullptr };
+		}
+
+		struct Range_Job
+		{
+			Thread_Pool* pool;
+			size_t begin;
+			size_t end;
+			size_t grain;
+			Function_Ref<void(size_t, size_t)> body;
+			Wait_Group* group;
+
+			void operator()()
+			{
+				pool->SplitRange(begin, end, grain, body);
+				group->Done();
+			}
+		};
+
+		void SplitRange(size_t Begin, size_t End, size_t Grain, Function_Ref<void(size_t, size_t)> Body)
+		{
+			if (End - Begin <= Grain)
+			{
+				Body(Begin, End);
+				return;
+			}
+
+			Wait_Group group;
+			while (End - Begin > Grain)
+			{
+				auto middle = Begin + (End - Begin) / 2;
+				group.Add();
+				Push(Range_Job{ this, middle, End, Grain, Body, &group });
+				End = middle;
+			}
+			Body(Begin, End);
+			Wait(group);
+		}
+
+	public:
+		/*
+		* @param ThreadCount [Number of worker threads, 0 uses the hardware concurrency].
+		*/
+		explicit Thread_Pool(size_t ThreadCount = 0)
+		{
+			if (ThreadCount == 0)
+				ThreadCount = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+			_workers.reserve(ThreadCount);
+			for (size_t i = 0; i < ThreadCount; i++)
+			{
+				auto worker = new Worker();
+				worker->randomState = 0x9E3779B97F4A7C15ull * (i + 1);
+				_workers.push_back(worker);
+			}
+			for (auto worker : _workers) //Started after _workers is complete, thieves iterate it without synchronization.
+				worker->thread = std::thread(&Thread_Pool::WorkerLoop, this, worker);
+		}
+
+		/*
+		* Runs every pending job, then joins the workers.
+		*/
+		~Thread_Pool()
+		{
+			{
+				std::lock_guard<std::mutex> mLock(_sleepMutex);
+				_stop.store(true, std::memory_order_relaxed);
+			}
+			_sleepCondition.notify_all();
+			for (auto worker : _workers)
+				worker->thread.join();
+			for (auto worker : _workers)
+				delete worker;
+		}
+
+		size_t ThreadCount() const noexcept
+		{
+			return _workers.size();
+		}
+
+		/*
+		* Queues a callable for execution. Called from a worker, the job goes to that worker's own deque.
+		* @param Target [Callable taking no arguments].
+		*/
+		template <typename Callable>
+		void Submit(Callable&& Target)
+		{
+			Push(Forward<Callable>(Target));
+		}
+
+		/*
+		* Queues a callable and tracks its completion in Group.
+		* @param Group [Wait group that is marked done after Target returns].
+		* @param Target [Callable taking no arguments].
+		*/
+		template <typename Callable>
+		void Submit(Wait_Group& Group, Callable&& Target)
+		{
+			Group.Add();
+			Push([&Group, target = decay_t<Callable>(Forward<Callable>(Target))]() mutable
+			{
+				target();
+				Group.Done();
+			});
+		}
+
+		/*
+		* Executes a single pending job on the calling thread, if there is one.
+		*/
+		bool TryRunOne()
+		{
+			auto self = CurrentWorker();
+			uint64_t externalState = reinterpret_cast<uintptr_t>(&self) | 1;
+			auto node = Find(self, self ? self->randomState : externalState);
+			if (!node)
+				return false;
+			Execute(node, self);
+			return true;
+		}
+
+		/*
+		* Blocks until Group finishes, executing pending jobs in the meantime instead of idling.
+		*/
+		void Wait(const Wait_Group& Group)
+		{
+			while (!Group.Finished())
+			{
+				if (!TryRunOne())
+					std::this_thread::yield();
+			}
+		}
+
+		/*
+		* Calls Body over [Begin, End), splitting the range in halves until chunks are at most Grain elements. Returns once every chunk is done.
+		* @param Body [Called with the [Begin, End) bounds of each chunk].
+		* @param Grain [Largest chunk handed to Body, 0 picks one based on the worker count].
+		*/
+		void ParallelFor(size_t Begin, size_t End, Function_Ref<void(size_t, size_t)> Body, size_t Grain = 0)
+		{
+			if (End <= Begin)
+				return;
+			if (Grain == 0)
+			{
+				Grain = (End - Begin) / (_workers.size() * 8);
+				Grain = Grain ? Grain : 1;
+			}
+			SplitRange(Begin, End, Grain, Body);
+		}
+
+		Thread_Pool(const Thread_Pool&) = delete;
+		Thread_Pool(Thread_Pool&&) = delete;
+		Thread_Pool& operator =(const Thread_Pool&) = delete;
+	};
+#pragma endregion Thread_Pool
+}
+
+#endif THREAD_POOL_H
\ No newline at end of file
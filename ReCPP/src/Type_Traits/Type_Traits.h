@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include "Definitions.h"
+
 namespace ACBYTES
 {
 #pragma region is_same
@@ -61,6 +65,23 @@ namespace ACBYTES
 	static constexpr bool is_pointer_v = is_pointer<T>::value;
 #pragma endregion is_pointer
 
+#pragma region remove_pointer
+	template <typename T>
+	struct remove_pointer
+	{
+		typedef T type;
+	};
+
+	template <typename T>
+	struct remove_pointer<T*>
+	{
+		typedef T type;
+	};
+
+	template <typename T>
+	using remove_pointer_t = typename remove_pointer<T>::type;
+#pragma endregion remove_pointer
+
 #pragma region is_array
 	template <typename T>
 	struct is_array
@@ -191,6 +212,38 @@ namespace ACBYTES
 	using remove_cv_t = typename remove_cv<T>::type;
 #pragma endregion cv
 
+#pragma region is_integral
+	template <typename T>
+	struct is_integral
+	{
+	private:
+		using type = remove_cv_t<T>;
+
+	public:
+		static constexpr bool value = is_same_v<type, bool> || is_same_v<type, char> || is_same_v<type, signed char> || is_same_v<type, unsigned char>
+			|| is_same_v<type, wchar_t> || is_same_v<type, char16_t> || is_same_v<type, char32_t>
+#ifdef __cpp_char8_t
+			|| is_same_v<type, char8_t>
+#endif
+			|| is_same_v<type, short> || is_same_v<type, unsigned short> || is_same_v<type, int> || is_same_v<type, unsigned int>
+			|| is_same_v<type, long> || is_same_v<type, unsigned long> || is_same_v<type, long long> || is_same_v<type, unsigned long long>;
+	};
+
+	template <typename T>
+	static constexpr bool is_integral_v = is_integral<T>::value;
+#pragma endregion is_integral
+
+#pragma region is_enum
+	template <typename T>
+	struct is_enum
+	{
+		static constexpr bool value = __is_enum(T);
+	};
+
+	template <typename T>
+	static constexpr bool is_enum_v = is_enum<T>::value;
+#pragma endregion is_enum
+
 #pragma region reference_types
 	template <typename T>
 	struct is_lvalue_reference
@@ -246,6 +299,56 @@ namespace ACBYTES
 	using remove_reference_t = typename remove_reference<T>::type;
 #pragma endregion remove_reference
 
+#pragma region is_function
+	//Function types (and references) ignore top-level const, which is what separates them from const-qualified object types here.
+	template <typename T>
+	struct is_function
+	{
+		static constexpr bool value = is_const<T>::value && is_same<typename remove_const<T>::type, T>::value && !is_lvalue_reference<T>::value && !is_rvalue_reference<T>::value;
+	};
+
+	template <typename T>
+	static constexpr bool is_function_v = is_function<T>::value;
+#pragma endregion is_function
+
+#pragma region decay
+	template <typename T>
+	struct decay
+	{
+	private:
+		typedef typename remove_reference<T>::type noRefType;
+
+	public:
+		typedef conditional_t<typename remove_array<noRefType>::type*, conditional_t<noRefType*, typename remove_cv<noRefType>::type, is_function<noRefType>::value>, is_array<noRefType>::value> type;
+	};
+
+	template <typename T>
+	using decay_t = typename decay<T>::type;
+#pragma endregion decay
+
+#pragma region index_sequence
+	template <size_t... Indices>
+	struct index_sequence
+	{
+		static constexpr size_t size = sizeof...(Indices);
+	};
+
+	template <size_t N, size_t... Indices>
+	struct make_index_sequence_helper
+	{
+		typedef typename make_index_sequence_helper<N - 1, N - 1, Indices...>::type type;
+	};
+
+	template <size_t... Indices>
+	struct make_index_sequence_helper<0, Indices...>
+	{
+		typedef index_sequence<Indices...> type;
+	};
+
+	template <size_t N>
+	using make_index_sequence = typename make_index_sequence_helper<N>::type;
+#pragma endregion index_sequence
+
 #pragma region Forward
 	template <typename T>
 	[[nodiscard]] constexpr T&& Forward(typename remove_reference<T>::type& R) noexcept
@@ -268,23 +371,103 @@ namespace ACBYTES
 	}
 #pragma endregion Move
 
-#pragma region is_base_of
+#pragma region Declval
+	//Only usable in unevaluated contexts.
 	template <typename T>
-	static constexpr bool TestBaseType(void*) noexcept
+	T&& Declval() noexcept;
+#pragma endregion Declval
+
+#pragma region invoke_result
+	template <typename Callable, typename... ArgT>
+	struct invoke_result
 	{
-		return false;
-	}
+		typedef decltype(Declval<Callable>()(Declval<ArgT>()...)) type;
+	};
 
+	template <typename Callable, typename... ArgT>
+	using invoke_result_t = typename invoke_result<Callable, ArgT...>::type;
+#pragma endregion invoke_result
+
+#pragma region member_function_traits
+	enum class Reference_Qualifier
+	{
+		NONE,
+		LVALUE, //&
+		RVALUE //&&
+	};
+
+	/*
+	* Splits a member function pointer type into its class, signature and qualifiers. value is false for other types.
+	*/
 	template <typename T>
-	static constexpr bool TestBaseType(T*) noexcept
+	struct member_function_traits
 	{
-		return true;
-	}
+		static constexpr bool value = false;
+	};
 
+	/*
+	* Member function pointer type with the qualifiers passed, the inverse of member_function_traits.
+	*/
+	template <typename RT, typename Class, bool Const, bool Volatile, Reference_Qualifier Ref, bool NoExcept, typename... ArgT>
+	struct member_function_pointer;
+
+	//Every cv/ref combination, noexcept is deduced.
+#define MEMBER_FUNCTION_QUALIFIERS(CONST, VOLATILE, REF, QUALIFIERS) \
+	template <typename RT, typename Class, bool NoExcept, typename... ArgT> \
+	struct member_function_traits<RT(Class::*)(ArgT...) QUALIFIERS noexcept(NoExcept)> \
+	{ \
+		static constexpr bool value = true; \
+		static constexpr bool is_const = CONST; \
+		static constexpr bool is_volatile = VOLATILE; \
+		static constexpr Reference_Qualifier reference = REF; \
+		static constexpr bool is_noexcept = NoExcept; \
+		typedef RT returnType; \
+		typedef Class classType; \
+		typedef RT signature(ArgT...); \
+	}; \
+	\
+	template <typename RT, typename Class, bool NoExcept, typename... ArgT> \
+	struct member_function_pointer<RT, Class, CONST, VOLATILE, REF, NoExcept, ArgT...> \
+	{ \
+		typedef RT(Class::*type)(ArgT...) QUALIFIERS noexcept(NoExcept); \
+	};
+
+	MEMBER_FUNCTION_QUALIFIERS(false, false, Reference_Qualifier::NONE, )
+	MEMBER_FUNCTION_QUALIFIERS(true, false, Reference_Qualifier::NONE, const)
+	MEMBER_FUNCTION_QUALIFIERS(false, true, Reference_Qualifier::NONE, volatile)
+	MEMBER_FUNCTION_QUALIFIERS(true, true, Reference_Qualifier::NONE, const volatile)
+	MEMBER_FUNCTION_QUALIFIERS(false, false, Reference_Qualifier::LVALUE, &)
+	MEMBER_FUNCTION_QUALIFIERS(true, false, Reference_Qualifier::LVALUE, const&)
+	MEMBER_FUNCTION_QUALIFIERS(false, true, Reference_Qualifier::LVALUE, volatile&)
+	MEMBER_FUNCTION_QUALIFIERS(true, true, Reference_Qualifier::LVALUE, const volatile&)
+	MEMBER_FUNCTION_QUALIFIERS(false, false, Reference_Qualifier::RVALUE, &&)
+	MEMBER_FUNCTION_QUALIFIERS(true, false, Reference_Qualifier::RVALUE, const&&)
+	MEMBER_FUNCTION_QUALIFIERS(false, true, Reference_Qualifier::RVALUE, volatile&&)
+	MEMBER_FUNCTION_QUALIFIERS(true, true, Reference_Qualifier::RVALUE, const volatile&&)
+#undef MEMBER_FUNCTION_QUALIFIERS
+
+	template <typename T>
+	static constexpr bool is_member_function_pointer_v = member_function_traits<remove_cv_t<T>>::value;
+#pragma endregion member_function_traits
+
+#pragma region array_element
+	/*
+	* Element type of an array pointer (Unique_Ptr<T[]>, Shared_Ptr<T[]> or anything else with Get() and Size()).
+	*/
+	template <typename Array>
+	using array_element_t = typename remove_reference<decltype(*Declval<Array&>().Get())>::type;
+#pragma endregion array_element
+
+	//The traits below are compiler intrinsics, supported by MSVC, GCC and Clang unless stated otherwise; they cost no template instantiations of their own.
+#pragma region is_base_of
+	/*
+	* Whether Class is Base or derives from it, through private and ambiguous bases as well. Always false for non-class types.
+	* Use is_convertible<Class*, Base*> to ask whether a pointer conversion is actually possible.
+	*/
 	template <typename Base, typename Class>
 	struct is_base_of
 	{
-		static constexpr bool value = TestBaseType<Base>(static_cast<Class*>(nullptr));
+		static constexpr bool value = __is_base_of(Base, Class);
 	};
 
 	template <typename Base, typename Class>
@@ -292,20 +475,224 @@ namespace ACBYTES
 #pragma endregion is_base_of
 
 #pragma region is_convertible
+	/*
+	* Whether a From expression implicitly converts to To, as in returning Declval<From>() from a function returning To.
+	*/
 	template <typename From, typename To>
 	struct is_convertible
 	{
-		static constexpr bool value = is_same<decltype((To)(*(static_cast<From*>(nullptr)))), To>::value;
+#if defined(_MSC_VER) && !defined(__clang__)
+		static constexpr bool value = __is_convertible_to(From, To);
+#elif ACBYTES_HAS_BUILTIN(__is_convertible)
+		static constexpr bool value = __is_convertible(From, To);
+#else
+	private:
+		template <typename To1>
+		static void Accept(To1) noexcept;
+
+		template <typename From1, typename To1, typename = decltype(Accept<To1>(Declval<From1>()))>
+		static constexpr bool Test(int) noexcept
+		{
+			return true;
+		}
+
+		template <typename, typename>
+		static constexpr bool Test(...) noexcept
+		{
+			return false;
+		}
+
+	public:
+		//Arrays and functions can't be returned, void only converts to void.
+		static constexpr bool value = is_same_v<remove_cv_t<To>, void> ? is_same_v<remove_cv_t<From>, void> : !is_array_v<To> && !is_function_v<To> && Test<From, To>(0);
+#endif
 	};
 
+	template <typename From, typename To>
+	static constexpr bool is_convertible_v = is_convertible<From, To>::value;
+#pragma endregion is_convertible
+
+#pragma region is_invocable_r
+	template <typename Callable, typename Signature, typename = void>
+	struct is_invocable_signature
+	{
+		static constexpr bool value = false;
+	};
+
+	template <typename Callable, typename RT, typename... ArgT>
+	struct is_invocable_signature<Callable, RT(ArgT...), decltype(Declval<Callable>()(Declval<ArgT>()...), void())>
+	{
+		static constexpr bool value = is_same_v<remove_cv_t<RT>, void> || is_convertible_v<invoke_result_t<Callable, ArgT...>, RT>;
+	};
+
+	/*
+	* Whether Callable can be called with ArgT and its result converts to RT (any result does to void). Not an intrinsic.
+	*/
+	template <typename RT, typename Callable, typename... ArgT>
+	struct is_invocable_r
+	{
+		static constexpr bool value = is_invocable_signature<Callable, RT(ArgT...)>::value;
+	};
+
+	template <typename RT, typename Callable, typename... ArgT>
+	static constexpr bool is_invocable_r_v = is_invocable_r<RT, Callable, ArgT...>::value;
+#pragma endregion is_invocable_r
+
+#pragma region is_empty
 	template <typename T>
-	struct is_convertible<T, T>
+	struct is_empty
 	{
-		static constexpr bool value = true;
+		static constexpr bool value = __is_empty(T);
 	};
 
-	template <typename From, typename To>
-	static constexpr bool is_convertible_v = is_convertible<From, To>::value;
-#pragma endregion is_convertible
+	template <typename T>
+	static constexpr bool is_empty_v = is_empty<T>::value;
+#pragma endregion is_empty
+
+#pragma region is_final
+	template <typename T>
+	struct is_final
+	{
+		static constexpr bool value = __is_final(T);
+	};
+
+	template <typename T>
+	static constexpr bool is_final_v = is_final<T>::value;
+#pragma endregion is_final
+
+#pragma region is_default_constructible
+	template <typename T>
+	struct is_default_constructible
+	{
+		static constexpr bool value = __is_constructible(T);
+	};
+
+	template <typename T>
+	static constexpr bool is_default_constructible_v = is_default_constructible<T>::value;
+#pragma endregion is_default_constructible
+
+#pragma region is_trivially_destructible
+	template <typename T>
+	struct is_trivially_destructible
+	{
+#if (defined(_MSC_VER) && !defined(__clang__)) || ACBYTES_HAS_BUILTIN(__is_trivially_destructible)
+		static constexpr bool value = __is_trivially_destructible(T);
+#else
+		static constexpr bool value = __has_trivial_destructor(T); //GCC's older spelling.
+#endif
+	};
+
+	template <typename T>
+	static constexpr bool is_trivially_destructible_v = is_trivially_destructible<T>::value;
+#pragma endregion is_trivially_destructible
+
+#pragma region is_trivially_copyable
+	template <typename T>
+	struct is_trivially_copyable
+	{
+		static constexpr bool value = __is_trivially_copyable(T);
+	};
+
+	template <typename T>
+	static constexpr bool is_trivially_copyable_v = is_trivially_copyable<T>::value;
+#pragma endregion is_trivially_copyable
+
+#pragma region is_trivially_relocatable
+	/*
+	* Whether moving a T into new storage and destroying the source amounts to copying its bytes, letting containers relocate it with memcpy/memmove.
+	* Holds for trivially copyable types; specialized next to types whose moves only hand over what they point to.
+	* Types pointing into themselves, like those with inline storage, must not be specialized.
+	*/
+	template <typename T>
+	struct is_trivially_relocatable
+	{
+		static constexpr bool value = is_trivially_copyable<T>::value;
+	};
+
+	template <typename T>
+	static constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+#pragma endregion is_trivially_relocatable
+
+#pragma region type_id
+	/*
+	* Identity of a type without RTTI.
+	* Value is unique per type within the program, Hash is a 64-bit FNV-1a of the compiler's signature string for the type and stays the same across runs and builds made with the same compiler.
+	* Hashes may collide, equality compares both, which also lets compilers evaluate it in constant expressions for distinct types.
+	*/
+	class Type_Id
+	{
+		const void* _value;
+		uint64_t _hash;
+
+	public:
+		constexpr Type_Id(const void* Value, uint64_t Hash) noexcept : _value(Value), _hash(Hash)
+		{
+		}
+
+		constexpr const void* Value() const noexcept
+		{
+			return _value;
+		}
+
+		constexpr uint64_t Hash() const noexcept
+		{
+			return _hash;
+		}
+
+		constexpr bool operator ==(const Type_Id& Other) const noexcept
+		{
+			return _hash == Other._hash && _value == Other._value;
+		}
+
+		constexpr bool operator !=(const Type_Id& Other) const noexcept
+		{
+			return !(*this == Other);
+		}
+	};
+
+	/*
+	* One writable byte per type whose address serves as its ID. Writable data isn't merged by identical COMDAT folding.
+	*/
+	template <typename T>
+	struct type_id_tag
+	{
+		static char tag;
+	};
+
+	template <typename T>
+	char type_id_tag<T>::tag = 0;
+
+	template <typename T>
+	constexpr uint64_t Type_Hash() noexcept
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		const char* signature = __FUNCSIG__;
+#else
+		const char* signature = __PRETTY_FUNCTION__;
+#endif
+		uint64_t hash = 14695981039346656037ull;
+		for (; *signature; signature++)
+		{
+			hash ^= static_cast<unsigned char>(*signature);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+	template <typename T>
+	constexpr Type_Id Type_Id_Of() noexcept
+	{
+		return Type_Id(&type_id_tag<T>::tag, Type_Hash<T>());
+	}
+
+	template <typename T>
+	struct type_hash
+	{
+		static constexpr uint64_t value = Type_Hash<T>();
+	};
+
+	template <typename T>
+	static constexpr uint64_t type_hash_v = type_hash<T>::value;
+#pragma endregion type_id
 }
 #endif TYPE_TRAITS_H
\ No newline at end of file
@@ -1,4 +1,279 @@
-int main()
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "Future.h"
+#include "Task.h"
+#include "Concurrent_Queue.h"
+#include "Parallel_Algorithms.h"
+#include "Bulk_Memory.h"
+#include "Small_Vector.h"
+#include "Object_Pool.h"
+#include "Function.h"
+#include "Flat_Map.h"
+
+using namespace ACBYTES;
+
+//Then on a finished future whose Promise is gone: the continuation holds the last reference to the shared state.
+static void Then_Without_Promise()
+{
+	Future<int> ready;
+	{
+		Promise<int> promise;
+		ready = promise.GetFuture();
+		promise.SetValue(4);
+	}
+	assert(ready.Then([](int Value) { return Value * 2; }).Get() == 8);
+
+	Future<int> abandoned;
+	{
+		Promise<int> promise;
+		abandoned = promise.GetFuture();
+	}
+	assert(abandoned.Then([](int Value) { return Value; }).Abandoned());
+}
+
+//Frames freed on another thread go back to the allocating pool, which outlives its thread until the last of them is freed.
+static void Frame_Pool_Remote_Free()
+{
+	void* frames[64];
+	std::thread([&frames] {
+		for (auto& frame : frames)
+			frame = Frame_Pool::Local().Allocate(256);
+	}).join();
+	for (auto frame : frames)
+		Frame_Pool::Deallocate(frame, 256);
+
+	std::thread([] {
+		auto frame = Frame_Pool::Local().Allocate(256);
+		std::thread([frame] { Frame_Pool::Deallocate(frame, 256); }).join();
+		void* reused[64];
+		size_t count = 0;
+		do
+			reused[count] = Frame_Pool::Local().Allocate(256);
+		while (reused[count++] != frame && count < 64);
+		assert(reused[count - 1] == frame);
+		for (size_t i = 0; i < count; i++)
+			Frame_Pool::Deallocate(reused[i], 256);
+	}).join();
+}
+
+//Batch operations with nothing to move return at once instead of retrying forever.
+static void Queue_Empty_Batch()
+{
+	MPMC_Queue<int> queue(4);
+	Unique_Ptr<int> items[1];
+	assert(queue.Push(items, 0) == 0);
+	assert(queue.Pop(items, 0) == 0);
+	assert(queue.Push(Make_Unique<int>(1)));
+	assert(queue.Pop(items, 0) == 0 && queue.Size() == 1);
+}
+
+//An integral grain after a single operation is the grain, not a Combiner.
+static void Reduce_With_Grain()
+{
+	Thread_Pool pool(2);
+	auto values = Make_Unique<long[]>(10000);
+	for (size_t i = 0; i < 10000; i++)
+		values[i] = 1;
+	assert(Parallel_Reduce(pool, values, 0L, [](long Sum, const long& Value) { return Sum + Value; }, 1000) == 10000);
+}
+
+//Elements with their own operator == are compared with it even when their bytes could be compared instead.
+static void Equal_Uses_Operator()
+{
+	struct Tagged
+	{
+		int value;
+		int tag; //Not part of equality.
+
+		bool operator ==(const Tagged& Other) const
+		{
+			return value == Other.value;
+		}
+	};
+
+	auto left = Make_Unique<Tagged[]>({ Tagged{ 1, 0 }, Tagged{ 2, 0 } });
+	auto right = Make_Unique<Tagged[]>({ Tagged{ 1, 5 }, Tagged{ 2, 6 } });
+	assert(Equal(left, right));
+
+	auto numbers = Make_Unique<int[]>({ 1, 2, 3 });
+	const int same[] = { 1, 2, 3 };
+	const int other[] = { 1, 2, 4 };
+	assert(Equal(numbers, same, 3) && !Equal(numbers, other, 3));
+}
+
+//Growing a container relocates Shared_Ptrs without counter traffic: std::vector moves them (noexcept, so never copies), Small_Vector copies their bytes.
+static_assert(is_trivially_relocatable_v<Shared_Ptr<int>> && std::is_nothrow_move_constructible_v<Shared_Ptr<int>>);
+
+static void Shared_Ptr_Relocation()
+{
+	auto shared = Make_Shared<int>(7);
+	std::vector<Shared_Ptr<int>> copies;
+	std::vector<Shared_Ptr<int>> owners;
+	size_t reallocations = 0;
+	for (int i = 0; i < 100; i++)
+	{
+		auto capacity = copies.capacity();
+		copies.push_back(shared);
+		owners.push_back(Make_Shared<int>(i));
+		reallocations += copies.capacity() != capacity;
+		assert(shared.UseCount() == copies.size() + 1);
+	}
+	assert(reallocations > 4);
+	for (int i = 0; i < 100; i++)
+		assert(owners[i].UseCount() == 1 && *owners[i].Get() == i);
+
+	Small_Vector<Shared_Ptr<int>, 2> small;
+	for (int i = 0; i < 100; i++)
+	{
+		small.PushBack(shared);
+		assert(shared.UseCount() == copies.size() + small.Size() + 1);
+	}
+	small.Emplace(0, owners[0]);
+	assert(owners[0].UseCount() == 2 && shared.UseCount() == 201);
+}
+
+//Sharded counts add up references held on several threads, and only report uniqueness once the other holders are gone.
+static void Sharded_Count_Queries()
 {
+	auto shared = Make_Shared<int, Shared_Count::SHARDED>(1);
+	std::vector<Shared_Ptr<int>> copies(4, shared);
+	std::thread([&copies, &shared] {
+		for (int i = 0; i < 4; i++)
+			copies.push_back(shared);
+	}).join();
+	assert(shared.UseCount() == 9 && !shared.Unique());
+	std::thread([&copies] { copies.resize(2); }).join();
+	assert(shared.UseCount() == 3);
+	copies.clear();
+	assert(shared.UseCount() == 1 && shared.Unique());
+	auto copy = shared;
+	assert(shared.UseCount() == 2 && !copy.Unique());
+}
 
+//An array Weak_Ptr outliving its array locks to an empty pointer instead of adopting the freed memory.
+static void Weak_Array_Expiry()
+{
+	Weak_Ptr<int[]> weak;
+	{
+		auto shared = Make_Shared<int[]>(4);
+		weak = shared;
+		assert(weak.Lock().UseCount() == 2 && weak.Lock().Size() == 4);
+	}
+	assert(weak.Expired() && !weak.Lock().Valid());
+}
+
+//A Pooled_Ptr doesn't convert to a Unique_Ptr whose deleter can't take over its pool deleter.
+static_assert(!std::is_constructible_v<Unique_Ptr<int>, Pooled_Ptr<int>&&> && !std::is_assignable_v<Unique_Ptr<int>&, Pooled_Ptr<int>&&>);
+
+//A thread's idle objects go back to the pool when it exits, and a pool-less Pooled_Ptr deletes its object.
+static void Pool_Thread_Exit()
+{
+	Object_Pool<int> pool;
+	std::thread([&pool] {
+		auto first = pool.Acquire();
+		auto second = pool.Acquire();
+	}).join();
+	assert(pool.Statistics().pooled == 2);
+	auto reused = pool.Acquire();
+	assert(pool.Statistics().hits == 1);
+
+	Pooled_Ptr<int> unpooled(new int(1));
+	unpooled.Reset();
+}
+
+//A WEAK Func returning a reference reports an expired object through TryCall instead of fabricating a result.
+static void Weak_Func_TryCall()
+{
+	struct Counter
+	{
+		int value = 0;
+
+		int& Value()
+		{
+			return value;
+		}
+	};
+
+	auto counter = Make_Shared<Counter>();
+	auto value = Function::WrapFunction<Function::Func_Binding::WEAK>(counter, &Counter::Value);
+	assert(value.TryCall([](int& Value) { Value = 5; }) && counter->value == 5);
+	counter = nullptr;
+	assert(!value.TryCall([](int&) { assert(false); }));
+}
+
+//A value constructor throwing during Emplace leaves the map as it was, not with a key missing its value.
+static void Flat_Map_Throwing_Value()
+{
+	struct Picky
+	{
+		int value;
+
+		Picky(int Value) : value(Value)
+		{
+			if (Value < 0)
+				throw Value;
+		}
+	};
+
+	Flat_Map<int, Picky, 2> map;
+	for (int i = 0; i < 4; i++)
+		map.Emplace(i, i);
+	bool threw = false;
+	try
+	{
+		map.Emplace(10, -1);
+	}
+	catch (int)
+	{
+		threw = true;
+	}
+	assert(threw && map.Size() == 4 && !map.Contains(10) && map.Find(3)->value == 3);
+}
+
+//Over-aligned elements keep their alignment after spilling to the heap.
+static void Small_Vector_Alignment()
+{
+	struct alignas(64) Line
+	{
+		int value;
+	};
+
+	Small_Vector<Line, 1> lines;
+	for (int i = 0; i < 16; i++)
+		lines.PushBack(Line{ i });
+	assert(!lines.IsInline() && reinterpret_cast<uintptr_t>(&lines[0]) % 64 == 0 && lines[15].value == 15);
+}
+
+//Get on a future completed long after the wait started parks the waiter and is woken by SetValue.
+static void Parked_Get()
+{
+	Promise<int> promise;
+	auto future = promise.GetFuture();
+	std::thread producer([&promise] {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		promise.SetValue(3);
+	});
+	assert(future.Get() == 3);
+	producer.join();
+}
+
+int main()
+{
+	Then_Without_Promise();
+	Frame_Pool_Remote_Free();
+	Queue_Empty_Batch();
+	Reduce_With_Grain();
+	Equal_Uses_Operator();
+	Shared_Ptr_Relocation();
+	Sharded_Count_Queries();
+	Weak_Array_Expiry();
+	Pool_Thread_Exit();
+	Weak_Func_TryCall();
+	Flat_Map_Throwing_Value();
+	Small_Vector_Alignment();
+	Parked_Get();
 }
\ No newline at end of file